@@ -26,28 +26,46 @@ static struct argp_option options[] = {
 	{"colA",    'A', "# of column",    0, "number of column to process",			0},
 	{"tmin",    'b', "tmin", 0, "start time in seconds",					0},
 	{"colB",    'B', "# of column",    0, "process column B - column A",			0},	
+	{"nchan",   'C', "# of channels", 0, "number of channels in raw binary files",	0},
 	{"param",   'c', "param", 0, "parameter string",					0},
 	{"usedefs", 'd', 0,       0, "use defaults",						0},
+	{"decatt",  'D', "dB", 0, "decimation filter attenuation in dB; 0 no decimation",	0},
+	{"oocmem",  'E', "MB", 0, "memory budget for the time series in MB; 0 all in memory",	0},
 	{"tmax",    'e', "tmax", 0, "stop time in seconds", 					0},
+	{"tfnfft",  'F', "nfft", 0, "smallest nfft for table-free kernel; 0 never",	0},
 	{"fsamp",   'f', "sampl. freq.", 0, "sampling frequency in Hertz",			0},
+	{"rigor",   'G', "rigor", 0, "FFTW planning rigor: estimate, measure, patient, exhaustive",	0},
 	{"gnuplot", 'g', "gnuplot file",  0, "gnuplot file name",				0},
-	{"method",  'h', "0, 1",   0, "method for frequency calculation: 0-LPSD, 1-FFT",	0},
-	{"input",   'i', "input file",  0, "input file name",					0},
+	{"hskip",   'H', "bytes", 0, "bytes to skip at the beginning of raw binary files",	0},
+	{"ifmt",    'I', "format", 0, "input format: text, npy, i16le, i16be, i32le, i32be, f32le, f32be, f64le, f64be",	0},
+	{"method",  'h', "0, 1, 2", 0, "method for frequency calculation: 0-LPSD, 1-FFT, 2-FFT in log bands",	0},
+	{"input",   'i', "input file",  0, "input file name; - for stdin",				0},
+	{"plan",    'J', "0,1,2", 0, "print the kernel plan; 0 no, 1 per kernel, 2 every task",	0},
 	{"fres",    'j', "FFT freq. res.", 0, "Frequency resolution for FFT", 			0},
+	{"cache",   'K', "0,1", 0, "keep parsed text input in a binary sidecar; 1 yes, 0 no",	0},
 	{"sbin",    'k', "sbin", 0, "smallest frequency bin",					0},
+	{"interleave", 'L', "0,1", 0, "raw binary channels; 1 interleaved, 0 one block each",	0},
 	{"ovlp",    'l', "overlap", 0, "segment overlap in %",	 				0},
+	{"submean", 'M', "0,1", 0, "subtract mean of data; 1 yes, 0 no",			0},
 	{"mavg",    'm', "# of min. avgs", 0, "minimum number of averages", 			0},
 	{"nspec",   'n', "# in spectr.", 0, "number of values in spectrum", 			0},
+	{"threads", 'N', "# of threads", 0, "number of worker threads; 0 one per processor",	0},
+	{"cachedir",'O', "directory", 0, "directory of the sidecars; next to the input if empty",	0},
 	{"output",  'o', "output file",  0, "output file name",					0},
+	{"compact", 'P', "0,1", 0, "keep int16, int32, float32 samples as they are; 1 yes, 0 no",	0},
 	{"psll",    'p', "psll", 0, "peak side lobe level in dB", 				0},
 	{"quiet",   'q', 0,       0, "Don't produce output on screen",				0},
+	{"maxread", 'R', "# of samples", 0, "most samples read from stdin or a pipe; 0 all",	0},
 	{"lr",      'r', "0,1",   0, "linear regression; 1 yes, 0 no", 				0},
+	{"sdft",    'S', "0,1,2", 0, "sliding DFT; 0 never, 1 if cheaper, 2 always",	0},
 	{"fmin",    's', "fmin", 0, "start frequency in spectrum", 				0},
 	{"fmax",    't', "fmax", 0, "stop frequency in spectrum", 				0},
 	{"time",    'T', 0, 0, "file contains time in s in first column",			0},	
 	{"gnuterm", 'u', "gnuterm", 0, "number of gnuplot terminal", 				0},
+	{"wincache",'W', "MB", 0, "memory budget of window table cache in MB",		0},
 	{"window",  'w', "wind. func.", 0, "window function; -2 Kaiser, -1 flat top, 0..30",  	0},
 	{"scale",   'x', "factor", 0,"scaling factor",						0},
+	{"gridtol", 'Y', "%", 0, "snap nfft to 2^a 3^b 5^c 7^d within % of the resolution; 0 never",	0},
 	{0,0,0,0,0,0}
 };
 
@@ -109,6 +127,15 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
 		arguments->nspec=atoi(arg);
 		arguments->asknspec=0;
 		break;
+	case 'N':
+		arguments->nthreads=atoi(arg);
+		break;
+	case 'W':
+		arguments->wincache=atof(arg);
+		break;
+	case 'F':
+		arguments->tfnfft=atoi(arg);
+		break;
 	case 'a':
 		arguments->desAVG=atoi(arg);
 		arguments->cmddesAVG=1;
@@ -143,6 +170,51 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
 		arguments->tmax=atof(arg);
 		arguments->asktmax=0;
 		break;
+	case 'S':
+		arguments->sdft=atoi(arg);
+		break;
+	case 'D':
+		arguments->decatt=atof(arg);
+		break;
+	case 'I':
+		strncpy(arguments->ifmt,arg,SLEN-1);
+		break;
+	case 'H':
+		arguments->hskip=atoi(arg);
+		break;
+	case 'C':
+		arguments->nchan=atoi(arg);
+		break;
+	case 'L':
+		arguments->interleave=atoi(arg);
+		break;
+	case 'M':
+		arguments->submean=atoi(arg);
+		break;
+	case 'K':
+		arguments->cache=atoi(arg);
+		break;
+	case 'O':
+		strncpy(arguments->cachedir,arg,FNLEN-1);
+		break;
+	case 'E':
+		arguments->oocmem=atof(arg);
+		break;
+	case 'R':
+		arguments->maxread=atoll(arg);
+		break;
+	case 'P':
+		arguments->compact=atoi(arg);
+		break;
+	case 'G':
+		strncpy(arguments->rigor,arg,SLEN-1);
+		break;
+	case 'J':
+		arguments->plan=atoi(arg);
+		break;
+	case 'Y':
+		arguments->gridtol=atof(arg);
+		break;
 	case 's':
 		arguments->fmin=atof(arg);
 		arguments->askfmin=0;
@@ -6,6 +6,11 @@
 #include <math.h>
 #include <string.h>
 #include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdint.h>
 #include "config.h"
 #include "misc.h"
 #include "errors.h"
@@ -13,24 +18,63 @@
 #include "debug.h"
 #include "IO.h"
 #include "StrParser.h"
+#include "scandbl.h"
+#include "workpool.h"
+#include "cache.h"
+#include "decomp.h"
+#include "detrend.h"
 
 
 static FILE *ifp = 0;			/* input file pointer */
 static char curline[DATALEN];		/* currently read input data line */
-static double curdata;			/* contains current data */
-static double curtime;			/* contains current time */
-static double dts;			/* sum of delta t's */
-static double dt2s;			/* sum of delta t^2's */
+static int pending = 0;			/* 1 if curline holds a line not returned by read_lof() yet */
 static double *data = 0;		/* pointer to all data */
-static int (*read_data) (void);		/* pointer to function reading input data */
+static long long nbuf = 0;		/* number of values in data */
+static long long abuf = 0;		/* number of values allocated for data */
+static int (*read_data) (const char *s, double *t, double *x);	/* function reading a line of input data */
 static unsigned int timecol;		/* column 1 contains time in s */
 static unsigned int colA;		/* read data from column A */
 static unsigned int colB;		/* read data from column B */
+static int decomma;			/* 1 if comma is decimal point */
+
+/* sample formats of raw binary input */
+typedef struct {
+	char name[8];
+	int size;			/* bytes per sample */
+	int isint;			/* 1 signed integer, 0 IEEE floating point */
+	int big;			/* 1 big endian, 0 little endian */
+} tSMPFMT;
+
+static const tSMPFMT smpfmts[] = {
+	{"i16le", 2, 1, 0}, {"i16be", 2, 1, 1},
+	{"i32le", 4, 1, 0}, {"i32be", 4, 1, 1},
+	{"f32le", 4, 0, 0}, {"f32be", 4, 0, 1},
+	{"f64le", 8, 0, 0}, {"f64be", 8, 0, 1}
+};
+
+static const int nsmpfmts = sizeof (smpfmts) / sizeof (tSMPFMT);
+
+static const char *bmap = 0;		/* mapped binary input file */
+static int bheap = 0;			/* 1 if bmap was read from a pipe or decompressed into memory */
+static size_t blen;			/* its length in bytes */
+static const tSMPFMT *bfmt;		/* its sample format */
+static int bswap;			/* 1 if the bytes of a sample must be swapped */
+static size_t boff;			/* offset of the first sample */
+static int bnch;			/* number of channels */
+static int bilv;			/* 1 interleaved, 0 one block per channel */
+static long long bframes;		/* number of samples per channel */
+static int mapped = 0;			/* 1 if data points into bmap */
+static int streamed = 0;		/* 1 if the data are read block by block */
+static const char *cdata = 0;		/* compact samples of column A, 0 if data holds the samples */
+static int ctype;			/* their type, SMP_I16, SMP_I32 or SMP_F32 */
+static int cown;			/* 1 if cdata was allocated, 0 if it points into bmap */
+static long long sel_start;		/* first value selected by read_file() */
+static double sel_ulsb, sel_mean;	/* and its scaling factor and mean */
 
 static void replaceComma(char *s);
-static int read_t_A_B(void);
-static int read_A_B(void);
-static int read_A(void);
+static int read_t_A_B(const char *s, double *t, double *x);
+static int read_A_B(const char *s, double *t, double *x);
+static int read_A(const char *s, double *t, double *x);
 
 /********************************************************************************
  *	replaces commas by decimal dots						*
@@ -47,135 +91,105 @@ static void replaceComma(char *s) {
 }
 
 /********************************************************************************
- *	reads time and two columns from a file					*
+ *	returns the start of field n (counted from 1) of the line s, fields
+ *	are separated by any number of spaces and tabs, the line ends at a
+ *	newline or 0; NULL if s has fewer than n fields
+ ********************************************************************************/
+static const char *field(const char *s, unsigned int n)
+{
+	for (;;) {
+		while (*s == ' ' || *s == '\t') s++;
+		if (*s == 0 || *s == '\n') return (NULL);
+		if (--n == 0) return (s);
+		while (*s != 0 && *s != ' ' && *s != '\t' && *s != '\n') s++;
+	}
+}
+
+/********************************************************************************
+ *	parses field n of the line s into *x, the fields are scanned in
+ *	place, commas are decimal points if decomma is 1
  *	returns:								*
  *		1 on success							*
  *		0 on failure							*
  ********************************************************************************/
-static int read_t_A_B(void)
+static int get_field(const char *s, unsigned int n, double *x)
 {
-	unsigned int n, ok = 0;
-	char s[DATALEN];
-	char *col;
-	double dataA, dataB;
-	
-	strcpy(&s[0],&curline[0]);
-	col=strtok(s,DATADEL);			/* ATTENTION: s gets altered by strtok */
-	if (sscanf(col,"%lg",&curtime)==1) 
-		ok = 1;
-
-//	printf("time=%f\t",curtime);
-
-	for (n=1; n<colA;n++) col=strtok(NULL,DATADEL);
-	if (sscanf(col,"%lg",&dataA)==1) 
-		ok = 1; else ok=0;
-//	printf("dataA=%f\t",dataA);
-	for (n=0; n<colB-colA;n++) col=strtok(NULL,DATADEL);
-	if (sscanf(col,"%lg",&dataB)==1) 
-		ok = 1; else ok=0;
-//	printf("dataB=%f\n",dataB);
-	curdata=dataB-dataA;
-
-	return (ok);
+	if ((s = field(s, n)) == NULL) return (0);
+	return (scan_double(s, decomma, x) != NULL);
 }
 
 /********************************************************************************
- *	reads time and one column from a file					*
+ *	reads time and two columns from the line s				*
  *	returns:								*
  *		1 on success							*
  *		0 on failure							*
  ********************************************************************************/
-static int read_t_A(void)
+static int read_t_A_B(const char *s, double *t, double *x)
 {
-	unsigned int n, ok = 0;
-	char s[DATALEN];
-	char *col;
-	
-	strcpy(&s[0],&curline[0]);
-
-	col=strtok(s,DATADEL);			/* ATTENTION: s gets altered by strtok */
-	if (sscanf(col,"%lg",&curtime)==1) 
-		ok = 1;
-
-//	printf("time=%f\t",curtime);
+	double dataA, dataB;
 
-	for (n=1; n<colA;n++) col=strtok(NULL,DATADEL);
-	if (sscanf(col,"%lg",&curdata)==1) 
-		ok = 1; else ok=0;
-//	printf("dataA=%f\t",curdata);
+	if (!get_field(s, 1, t)) return (0);
+	if (!get_field(s, colA, &dataA)) return (0);
+	if (!get_field(s, colB, &dataB)) return (0);
+	*x=dataB-dataA;
+	return (1);
+}
 
-	return (ok);
+/********************************************************************************
+ *	reads time and one column from the line s				*
+ *	returns:								*
+ *		1 on success							*
+ *		0 on failure							*
+ ********************************************************************************/
+static int read_t_A(const char *s, double *t, double *x)
+{
+	if (!get_field(s, 1, t)) return (0);
+	return (get_field(s, colA, x));
 }
 
 /********************************************************************************
- *	reads two columns from a file						*
+ *	reads two columns from the line s					*
  *	returns:								*
  *		1 on success							*
  *		0 on failure							*
  ********************************************************************************/
-static int read_A_B(void)
+static int read_A_B(const char *s, double *t, double *x)
 {
-	unsigned int n, ok = 0;
-	char s[DATALEN];
-	char *col;
 	double dataA, dataB;
 
-	strcpy(&s[0],&curline[0]);
-	
-	col=strtok(s,DATADEL);			/* ATTENTION: s gets altered by strtok */
-	for (n=1; n<colA;n++) col=strtok(NULL,DATADEL);
-	if (sscanf(col,"%lg",&dataA)==1) 
-		ok = 1; else ok=0;
-//	printf("dataA=%f\t",dataA);
-	for (n=0; n<colB-colA;n++) col=strtok(NULL,DATADEL);
-	if (sscanf(col,"%lg",&dataB)==1) 
-		ok = 1; else ok=0;
-//	printf("dataB=%f\n",dataB);
-	curdata=dataB-dataA;
-
-	return (ok);
+	(void) t;
+	if (!get_field(s, colA, &dataA)) return (0);
+	if (!get_field(s, colB, &dataB)) return (0);
+	*x=dataB-dataA;
+	return (1);
 }
 
 /********************************************************************************
- *	reads one column from a file						*
+ *	reads one column from the line s					*
  *	returns:								*
  *		1 on success							*
  *		0 on failure							*
  ********************************************************************************/
-static int read_A(void)
+static int read_A(const char *s, double *t, double *x)
 {
-	unsigned int n, ok = 0;
-	char s[DATALEN];
-	char *col;
-
-	strcpy(&s[0],&curline[0]);
-	
-	col=strtok(s,DATADEL);			/* ATTENTION: s gets altered by strtok */
-	for (n=1; n<colA;n++) col=strtok(NULL,DATADEL);
-	if (sscanf(col,"%lg",&curdata)==1) 
-		ok = 1; else ok=0;
-//	printf("dataA=%f\n",curdata);
-
-	return (ok);
+	(void) t;
+	return (get_field(s, colA, x));
 }
 
 /********************************************************************************
  *	reads one line from a file					*
- *	parameters:								*
- *		int comma		1 if comma is decimal point, 0 otherwise*
  *	returns:								*
  *		2 if first character is comment character #			*
  *		1 on success							*
  *		0 on failure							*
  *		copies line of data into curline				*
  ********************************************************************************/
-static int read_lof(int comma) {
+static int read_lof(void) {
 	int ok=0;
 	
-	if (0 != fgets(&curline[0], DATALEN, ifp)) {		/* read max. DATALEN-1 characters */
+	if (pending || 0 != fgets(&curline[0], DATALEN, ifp)) {	/* read max. DATALEN-1 characters */
+		pending=0;
 		ok=1;
-		/* replace commas by decimal points */
-		if (comma == 1) replaceComma(curline);
 		/* test for comment character */
 		if (curline[0]=='#') ok=2;
 	}
@@ -183,14 +197,50 @@ static int read_lof(int comma) {
 
 }
 
+/* returns 1 if fn is "-" (standard input), a pipe or another file that can be read only once */
+int is_stream(char *fn)
+{
+	struct stat st;
+
+	if (strcmp(fn, "-") == 0) return (1);
+	return (stat(fn, &st) == 0 && !S_ISREG(st.st_mode));
+}
+
+/*
+	opens the input fn, "-" is standard input; a pipe, and a regular file
+	if decode is 1, is decompressed while it is read if it is compressed
+*/
+static FILE *open_input(char *fn, const char *mode, int decode)
+{
+	FILE *fp;
+	unsigned char head[DCMAGIC];
+	size_t n;
+	int fmt, stream = is_stream(fn);
+
+	fp = (strcmp(fn, "-") == 0) ? stdin : fopen(fn, mode);
+	if (fp == 0 || !(decode || stream)) return (fp);
+	n = fread(head, 1, DCMAGIC, fp);
+	fmt = decomp_detect(head, n);
+	if (!stream && fmt == DC_NONE) {
+		rewind(fp);
+		return (fp);
+	}
+	return (decomp_fopen(fmt, fp, head, n, fn));
+}
+
 /* returns 1 if file fn exists, 0 otherwise */
 int exists(char *fn)
 {
+	FILE *fp;
 	int ok = 0;
-	ifp = fopen(fn, "r");
-	if (ifp != 0) {
+
+	/* a pipe is not opened, that would take data from it or end it */
+	if (is_stream(fn))
+		return (strcmp(fn, "-") == 0 || access(fn, R_OK) == 0);
+	fp = fopen(fn, "r");
+	if (fp != 0) {
 		ok = 1;
-		fclose(ifp);
+		fclose(fp);
 	}
 	return (ok);
 }
@@ -214,6 +264,9 @@ int exists(char *fn)
  *
  *	delimiters after the last column confuse getNoC - they get counted as
  *	another column
+ *
+ *	a pipe stays open for probe_file(), its first line is read again
+ *	from curline
  ********************************************************************************/
 int getNoC(char *fn, int *comma)
 {
@@ -221,11 +274,18 @@ int getNoC(char *fn, int *comma)
 	char s[DATALEN];
 	int n=-1;
 	char *col;
+	int stream = is_stream(fn);
 	
-	fp = fopen(fn, "rb");
+	fp = open_input(fn, stream ? "r" : "rb", 1);
+	if (stream) ifp = fp;
 	if (fp != 0) {
+		s[0] = 0;
 		fgets(s, DATALEN, fp);	/* read max. DATALEN-1 characters */
 		/* first line of file has been read */
+		if (stream) {
+			strcpy(curline, s);
+			pending = 1;
+		}
 		*comma = (int) strchr(s, ',') ? 1 : 0;
 		/* replace commas by decimal points */
 		if (*comma == 1) replaceComma(s);
@@ -234,46 +294,641 @@ int getNoC(char *fn, int *comma)
 		if (col!=NULL) {
 			for (n=1; ((col=strtok(NULL,DATADEL))!=NULL);n++);
 		} else n=0;
-		fclose(fp);
 //		printf("Number of columns: %d\n",n);
+		if (!stream) fclose(fp);
 	}
 	return (n);
 }
 
+/* appends x to the data buffer, which grows by doubling */
+static void append_data(double x) {
+	if (nbuf == abuf) {
+		abuf = (abuf > 0) ? 2 * abuf : 65536;
+		data = (double *) xrealloc(data, abuf * sizeof(double));
+	}
+	data[nbuf++] = x;
+}
+
+/* time statistics and first unreadable line of a part of the file */
+typedef struct {
+	const char *begin;		/* first line */
+	const char *end;		/* end of the last line */
+	long long nlines;		/* number of data lines */
+	long long offset;		/* index of the first data line in data */
+	long long bad;			/* first unreadable data line, -1 if none */
+	double t0, t1;			/* time of first and last data line */
+	double dts, dt2s;		/* sums of delta t's and delta t^2's */
+} tCHUNK;
+
+/* counts the data lines of chunk c, lines starting with # are comments */
+static void count_chunk(int c, void *arg)
+{
+	tCHUNK *ch = (tCHUNK *) arg + c;
+	const char *p = ch->begin, *nl;
+	long long n = 0;
+
+	while (p < ch->end) {
+		if (*p != '#') n++;
+		nl = (const char *) memchr(p, '\n', ch->end - p);
+		p = (nl != NULL) ? nl + 1 : ch->end;
+	}
+	ch->nlines = n;
+}
+
+/* parses the data lines of chunk c into data[offset...] */
+static void parse_chunk(int c, void *arg)
+{
+	tCHUNK *ch = (tCHUNK *) arg + c;
+	const char *p = ch->begin, *nl;
+	double t = 0, last = 0, x;
+	long long n = 0;
+
+	ch->bad = -1;
+	ch->dts = ch->dt2s = 0;
+	while (p < ch->end && n < ch->nlines) {
+		if (*p != '#') {
+			if (1 != read_data(p, &t, &x)) {
+				ch->bad = n;
+				return;
+			}
+			data[ch->offset + n] = x;
+			if (n > 0) {
+				ch->dts += t - last;
+				ch->dt2s += (t - last) * (t - last);
+			} else
+				ch->t0 = t;
+			last = t;
+			n++;
+		}
+		nl = (const char *) memchr(p, '\n', ch->end - p);
+		p = (nl != NULL) ? nl + 1 : ch->end;
+	}
+	ch->t1 = last;
+}
+
+/********************************************************************************
+ *	maps the file fd of size len into memory, splits it into chunks of
+ *	about CHUNKLEN bytes that end after a newline, counts their data lines
+ *	and parses them on nthreads threads into data; a compressed file fn
+ *	is decompressed into memory first
+ *
+ *	returns the number of data lines, the sums of delta t's and delta t^2's
+ *	in *dts and *dt2s; -1 if the file cannot be mapped
+ ********************************************************************************/
+static long long parse_mapped(char *fn, int fd, size_t len, int nthreads, double *dts, double *dt2s)
+{
+	const char *map, *p, *q;
+	char *tail = 0, *text = 0;
+	tCHUNK *ch;
+	double *cost, lasttime = 0;
+	size_t ntail = 0, n0;
+	long long n;
+	int nch, c, prev, fmt;
+	char errmsg[200];
+
+	map = (const char *) mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED) return (-1);
+	madvise((void *) map, len, MADV_SEQUENTIAL);
+
+	/* a compressed file is parsed from its decompressed copy */
+	fmt = decomp_detect((const unsigned char *) map, len);
+	if (fmt != DC_NONE) {
+		text = decomp_buffer(fmt, map, len, nthreads, &n0, fn);
+		munmap((void *) map, len);
+		map = text;
+		len = n0;
+		if (len == 0) {
+			xfree(text);
+			*dts = *dt2s = 0;
+			return (0);
+		}
+	}
+
+	/* a last line without newline gets a terminated copy, the parser never reads past a newline */
+	if (map[len - 1] != '\n') {
+		for (ntail = 0; ntail < len && map[len - 1 - ntail] != '\n'; ntail++);
+		tail = (char *) xmalloc(ntail + 1);
+		memcpy(tail, map + len - ntail, ntail);
+		tail[ntail] = '\n';
+	}
+
+	nch = (int) ((len - ntail) / CHUNKLEN) + 2;
+	ch = (tCHUNK *) xmalloc(nch * sizeof(tCHUNK));
+	cost = (double *) xmalloc(nch * sizeof(double));
+	for (c = 0, p = map; p < map + len - ntail; c++) {
+		q = p + CHUNKLEN;
+		if (q >= map + len - ntail)
+			q = map + len - ntail;
+		else
+			q = (const char *) memchr(q - 1, '\n', map + len - ntail - (q - 1)) + 1;
+		ch[c].begin = p;
+		ch[c].end = q;
+		p = q;
+	}
+	if (tail != 0) {
+		ch[c].begin = tail;
+		ch[c].end = tail + ntail + 1;
+		c++;
+	}
+	nch = c;
+	for (c = 0; c < nch; c++)
+		cost[c] = (double) (ch[c].end - ch[c].begin);
+
+	/* data lines per chunk and where they go */
+	run_tasks(nch, cost, nthreads, count_chunk, ch, NULL);
+	for (c = 0, n = 0; c < nch; c++) {
+		ch[c].offset = n;
+		n += ch[c].nlines;
+	}
+	nbuf = abuf = n;
+	data = (double *) xrealloc(data, (n > 0 ? n : 1) * sizeof(double));
+
+	run_tasks(nch, cost, nthreads, parse_chunk, ch, NULL);
+
+	/* first error and time differences, also across chunk boundaries */
+	*dts = *dt2s = 0;
+	for (c = 0, prev = 0; c < nch; c++) {
+		if (ch[c].bad >= 0) {
+			sprintf(errmsg,"Error reading file in data line %lld\n",ch[c].offset + ch[c].bad);
+			gerror(errmsg);
+		}
+		if (ch[c].nlines == 0) continue;
+		if (prev) {
+			*dts += ch[c].t0 - lasttime;
+			*dt2s += (ch[c].t0 - lasttime) * (ch[c].t0 - lasttime);
+		}
+		*dts += ch[c].dts;
+		*dt2s += ch[c].dt2s;
+		lasttime = ch[c].t1;
+		prev = 1;
+	}
+
+	xfree(cost);
+	xfree(ch);
+	if (tail != 0) xfree(tail);
+	if (text != 0) xfree(text);
+	else munmap((void *) map, len);
+	return (n);
+}
+
+/********************************************************************************
+ *	reads the file line by line, for files that cannot be mapped
+ *	stops after nmax data lines if nmax > 0, and after the first line
+ *	more than tmax after the first one if tmax >= 0
+ *	returns the number of data lines, the sums of delta t's and delta t^2's
+ ********************************************************************************/
+static long long parse_stream(long long nmax, double tmax, double *dts, double *dt2s)
+{
+	long long nread = 0;
+	double t = 0, x, lasttime = 0.0;
+	char errmsg[200];
+
+	*dts = *dt2s = 0;
+	while ((nmax <= 0 || nread < nmax) && (tmax < 0 || nread == 0 || *dts <= tmax)
+	       && 0 < read_lof()) {
+		if (curline[0]!='#') {
+			if (1==read_data(curline, &t, &x)) {
+				append_data(x);
+				if (nread > 0) {
+					*dts += t - lasttime;
+					*dt2s += (t - lasttime) * (t - lasttime);
+				}
+				lasttime = t;
+				nread++;
+			} else {
+				sprintf(errmsg,"Error reading file in data line %lld\n",nread);
+				gerror(errmsg);
+			}	
+		}
+	}
+	return (nread);
+}
+
+/* 1 if this machine is big endian */
+static int host_big(void)
+{
+	const uint16_t one = 1;
+
+	return (*(const unsigned char *) &one == 0);
+}
+
+/* address of sample i of channel c (counted from 1) of the binary input */
+static const char *sample_ptr(long long i, unsigned int c)
+{
+	return (bmap + boff + (bilv ? (size_t) i * bnch + c - 1 : (size_t) (c - 1) * bframes + i) * bfmt->size);
+}
+
+/* sample i of channel c (counted from 1) of the binary input */
+static double sample(long long i, unsigned int c)
+{
+	const char *p;
+	uint16_t u16;
+	uint32_t u32;
+	uint64_t u64;
+	int16_t i16;
+	int32_t i32;
+	float f;
+	double d;
+
+	p = sample_ptr(i, c);
+	switch (bfmt->size) {
+	case 2:
+		memcpy(&u16, p, 2);
+		if (bswap) u16 = __builtin_bswap16(u16);
+		memcpy(&i16, &u16, 2);
+		return (i16);
+	case 4:
+		memcpy(&u32, p, 4);
+		if (bswap) u32 = __builtin_bswap32(u32);
+		if (bfmt->isint) {
+			memcpy(&i32, &u32, 4);
+			return (i32);
+		}
+		memcpy(&f, &u32, 4);
+		return (f);
+	default:
+		memcpy(&u64, p, 8);
+		if (bswap) u64 = __builtin_bswap64(u64);
+		memcpy(&d, &u64, 8);
+		return (d);
+	}
+}
+
+/* value i of the binary input: column A, or column B - column A */
+static double binary_value(long long i)
+{
+	return ((colB > 0) ? sample(i, colB) - sample(i, colA) : sample(i, colA));
+}
+
+/* converts the samples of task c, *arg samples per task, into data */
+static void convert_chunk(int c, void *arg)
+{
+	int n = *(int *) arg;
+	long long i, i1;
+
+	i1 = (c + 1 < bframes / n + 1) ? (long long) (c + 1) * n : bframes;
+	for (i = (long long) c * n; i < i1; i++)
+		data[i] = binary_value(i);
+}
+
+/* sample i of the compact data */
+static double compact_value(long long i)
+{
+	switch (ctype) {
+	case SMP_I16:
+		return (((const int16_t *) cdata)[i]);
+	case SMP_I32:
+		return (((const int32_t *) cdata)[i]);
+	default:
+		return (((const float *) cdata)[i]);
+	}
+}
+
+/* copies the samples of column A of task c, *arg samples per task, into cdata in native byte order */
+static void compact_chunk(int c, void *arg)
+{
+	int n = *(int *) arg;
+	char *q;
+	uint16_t u16;
+	uint32_t u32;
+	long long i, i1;
+
+	i1 = (c + 1 < bframes / n + 1) ? (long long) (c + 1) * n : bframes;
+	for (i = (long long) c * n; i < i1; i++) {
+		q = (char *) cdata + (size_t) i * bfmt->size;
+		if (bfmt->size == 2) {
+			memcpy(&u16, sample_ptr(i, colA), 2);
+			if (bswap) u16 = __builtin_bswap16(u16);
+			memcpy(q, &u16, 2);
+		} else {
+			memcpy(&u32, sample_ptr(i, colA), 4);
+			if (bswap) u32 = __builtin_bswap32(u32);
+			memcpy(q, &u32, 4);
+		}
+	}
+}
+
+/* value of the entry 'key': in the .npy header h[0..n-1], NULL if missing */
+static const char *npy_value(const char *h, size_t n, const char *key)
+{
+	size_t k = strlen(key), i;
+
+	for (i = 0; i + k < n; i++)
+		if (memcmp(h + i, key, k) == 0) {
+			for (i += k; i < n && (h[i] == ':' || h[i] == ' '); i++);
+			return (i < n ? h + i : NULL);
+		}
+	return (NULL);
+}
+
+/* offset of the data in the .npy file fn from its preamble, and the header length */
+static size_t npy_offset(char *fn, size_t *hlen)
+{
+	if (blen < 10 || memcmp(bmap, "\x93NUMPY", 6) != 0)
+		gerror1("%s is not a .npy file", fn);
+	if (bmap[6] == 1) {
+		*hlen = (unsigned char) bmap[8] | (size_t) (unsigned char) bmap[9] << 8;
+		return (10 + *hlen);
+	}
+	if (blen < 12) gerror1("%s is not a .npy file", fn);
+	*hlen = (unsigned char) bmap[8] | (size_t) (unsigned char) bmap[9] << 8
+		| (size_t) (unsigned char) bmap[10] << 16 | (size_t) (unsigned char) bmap[11] << 24;
+	return (12 + *hlen);
+}
+
+/********************************************************************************
+ *	parses the header of the mapped .npy file fn: format, offset of the
+ *	data, channels (second dimension of the array) and their layout
+ *	writes the name of the sample format to name
+ ********************************************************************************/
+static void npy_header(char *fn, char *name)
+{
+	const char *h, *v;
+	size_t hlen;
+	long long n0, n1 = 1;
+	int size;
+
+	boff = npy_offset(fn, &hlen);
+	if (boff > blen) gerror1("Truncated .npy header in %s", fn);
+	h = bmap + boff - hlen;
+
+	/* 'descr': '<f8' */
+	v = npy_value(h, hlen, "'descr'");
+	if (v == NULL || *v != '\'' || v + 4 >= h + hlen)
+		gerror1("No data type in .npy header of %s", fn);
+	size = atoi(v + 3);
+	if ((v[2] != 'f' && v[2] != 'i') || (size != 2 && size != 4 && size != 8))
+		gerror1("Unsupported data type in .npy file %s", fn);
+	sprintf(name, "%c%d%s", v[2], 8 * size, (v[1] == '>' || (v[1] == '|' && host_big())
+		|| (v[1] == '=' && host_big())) ? "be" : "le");
+
+	/* 'fortran_order': True stores the columns one after the other */
+	v = npy_value(h, hlen, "'fortran_order'");
+	bilv = !(v != NULL && v + 4 <= h + hlen && memcmp(v, "True", 4) == 0);
+
+	/* 'shape': (n0,) or (n0, n1) */
+	v = npy_value(h, hlen, "'shape'");
+	if (v == NULL || *v != '(')
+		gerror1("No shape in .npy header of %s", fn);
+	n0 = strtoll(v + 1, (char **) &v, 10);
+	while (*v == ' ' || *v == ',') v++;
+	if (*v != ')') n1 = strtoll(v, (char **) &v, 10);
+	while (*v == ' ' || *v == ',') v++;
+	if (*v != ')' || n0 < 0 || n1 < 1)
+		gerror1("Unsupported shape in .npy file %s", fn);
+	bnch = (int) n1;
+	bframes = n0;
+}
+
+/*
+	reads the input into memory until it holds len bytes, all of it if
+	len is 0, for pipes that cannot be mapped; bmap grows by doubling
+*/
+static void load_stream(size_t len)
+{
+	static size_t alen = 0;		/* bytes allocated for bmap */
+	char *b = (char *) bmap;
+	size_t n;
+
+	if (!bheap) {
+		b = 0;
+		blen = alen = 0;
+		bheap = 1;
+	}
+	while (len == 0 || blen < len) {
+		if (blen == alen) {
+			alen = (alen > 0) ? 2 * alen : CHUNKLEN;
+			b = (char *) xrealloc(b, alen);
+		}
+		n = alen - blen;
+		if (len > 0 && n > len - blen) n = len - blen;
+		n = fread(b + blen, 1, n, ifp);
+		blen += n;
+		if (n == 0) break;
+	}
+	bmap = b;
+}
+
+/* releases the binary input, mapped, read from a pipe or decompressed */
+static void release_input(void)
+{
+	if (bmap == 0) return;
+	if (bheap) xfree((void *) bmap);
+	else munmap((void *) bmap, blen);
+	bmap = 0;
+	bheap = 0;
+}
+
 /********************************************************************************
- *	reads file *fn, counts number of data points and determines mean of data
+ *	maps the binary file fn into memory and selects its samples, a
+ *	compressed file is decompressed into memory
+ *	npy	.npy file, the header gives format and layout
+ *	otherwise raw samples in format ifmt after hskip bytes, nchan
+ *	channels, interleaved if interleave is 1
+ *	a pipe is read into memory instead, if nmax > 0 and the channels are
+ *	interleaved only as far as needed for nmax samples
+ *
+ *	if stream is 1, all samples stay in the file and are converted by
+ *	read_block(); otherwise float64 samples in the byte order of this
+ *	machine are used where they are in the file if only one of them is
+ *	needed per time step, the other formats are converted on nthreads threads
+ *	if compact is 1, int16, int32 and float32 samples of column A are
+ *	kept as they are, in place if possible, and scaled by the kernels
+ *
+ *	returns the number of samples, the sums of delta t's and delta t^2's
+ ********************************************************************************/
+static long long probe_binary(char *fn, char *ifmt, int hskip, int nchan, int interleave,
+			int nthreads, int stream, int compact, long long nmax, double *dts, double *dt2s)
+{
+	struct stat st;
+	char name[SLEN];
+	const char *p;
+	double *cost, d;
+	long long i;
+	size_t hlen, olen, frame;
+	int n, ntask, piped, fmt;
+
+	piped = (fstat(fileno(ifp), &st) != 0 || !S_ISREG(st.st_mode));
+	if (piped) {
+		bmap = 0;
+		bheap = 0;
+		if (strcmp(ifmt, "npy") == 0) {
+			load_stream(12);
+			load_stream(npy_offset(fn, &hlen));
+		}
+	} else {
+		if (st.st_size == 0)
+			gerror1("Binary input %s must not be empty", fn);
+		blen = (size_t) st.st_size;
+		bmap = (const char *) mmap(NULL, blen, PROT_READ, MAP_PRIVATE, fileno(ifp), 0);
+		if (bmap == MAP_FAILED)
+			gerror1("Error mapping %s", fn);
+		/* a compressed file is decompressed into memory */
+		fmt = decomp_detect((const unsigned char *) bmap, blen);
+		if (fmt != DC_NONE) {
+			p = decomp_buffer(fmt, bmap, blen, nthreads, &olen, fn);
+			munmap((void *) bmap, blen);
+			bmap = p;
+			blen = olen;
+			bheap = 1;
+			if (blen == 0)
+				gerror1("Binary input %s must not be empty", fn);
+		}
+		nmax = 0;
+	}
+
+	if (strcmp(ifmt, "npy") == 0)
+		npy_header(fn, name);
+	else {
+		strcpy(name, ifmt);
+		boff = (size_t) hskip;
+		bnch = nchan;
+		bilv = interleave;
+	}
+	for (bfmt = 0, i = 0; i < nsmpfmts; i++)
+		if (strcmp(name, smpfmts[i].name) == 0) bfmt = &smpfmts[i];
+	if (bfmt == 0) gerror1("Unknown input format %s", ifmt);
+	if (bnch < 1) gerror("Wrong header length or number of channels!\n");
+	frame = (size_t) bfmt->size * bnch;
+	if (piped) {
+		/* a block per channel needs all of them */
+		if (nmax > 0 && (bilv || bnch == 1)) {
+			if (strcmp(ifmt, "npy") == 0 && nmax > bframes) nmax = bframes;
+			load_stream(boff + (size_t) nmax * frame);
+		} else if (strcmp(ifmt, "npy") == 0)
+			load_stream(boff + (size_t) bframes * frame);
+		else
+			load_stream(0);
+	}
+	if (boff > blen) gerror("Wrong header length or number of channels!\n");
+	if (strcmp(ifmt, "npy") != 0)
+		bframes = (long long) ((blen - boff) / frame);
+	else if (boff + (size_t) bframes * frame > blen) {
+		if (nmax <= 0 || !(bilv || bnch == 1))
+			gerror1("Truncated .npy file %s", fn);
+		bframes = (long long) ((blen - boff) / frame);
+	}
+	if (nmax > 0 && bframes > nmax && (bilv || bnch == 1))
+		bframes = nmax;
+	if (colA < 1 || (int) colA > bnch || (int) colB > bnch)
+		gerror("Column not contained in binary input file!\n");
+	bswap = (bfmt->big != host_big());
+
+	/* use float64 data in place */
+	mapped = 0;
+	if (!stream && !bfmt->isint && bfmt->size == sizeof(double) && !bswap && colB == 0
+	    && (bilv == 0 || bnch == 1)) {
+		p = bmap + boff + (size_t) (colA - 1) * bframes * sizeof(double);
+		if ((uintptr_t) p % sizeof(double) == 0) {
+			data = (double *) p;
+			mapped = 1;
+		}
+	}
+	/* or the samples of column A in their own format */
+	cdata = 0;
+	if (compact && !stream && colB == 0 && bfmt->size < 8) {
+		ctype = (bfmt->size == 2) ? SMP_I16 : (bfmt->isint ? SMP_I32 : SMP_F32);
+		p = bmap + boff + (size_t) (colA - 1) * bframes * bfmt->size;
+		cown = (bswap || (bilv && bnch > 1) || (uintptr_t) p % bfmt->size != 0);
+		if (cown) {
+			cdata = (const char *) xmalloc((bframes > 0 ? bframes : 1) * bfmt->size);
+			n = CHUNKLEN / (bfmt->size * bnch) + 1;
+			ntask = (int) ((bframes + n - 1) / n);
+			cost = (double *) xmalloc((ntask > 0 ? ntask : 1) * sizeof(double));
+			for (i = 0; i < ntask; i++) cost[i] = 1;
+			run_tasks(ntask, cost, nthreads, compact_chunk, &n, NULL);
+			xfree(cost);
+		} else
+			cdata = p;
+	}
+	if (stream) {
+		data = 0;
+		streamed = 1;
+	} else if (cdata) {
+		data = 0;
+	} else if (!mapped) {
+		data = (double *) xrealloc(data, (bframes > 0 ? bframes : 1) * sizeof(double));
+		n = CHUNKLEN / (bfmt->size * bnch) + 1;
+		ntask = (int) ((bframes + n - 1) / n);
+		cost = (double *) xmalloc((ntask > 0 ? ntask : 1) * sizeof(double));
+		for (i = 0; i < ntask; i++) cost[i] = 1;
+		run_tasks(ntask, cost, nthreads, convert_chunk, &n, NULL);
+		xfree(cost);
+	}
+
+	*dts = *dt2s = 0;
+	if (timecol)
+		for (i = 1; i < bframes && (nmax <= 0 || i < nmax); i++) {
+			d = sample(i, 1) - sample(i - 1, 1);
+			*dts += d;
+			*dt2s += d * d;
+		}
+
+	if (!mapped && !streamed && !(cdata && !cown))
+		release_input();
+	nbuf = abuf = bframes;
+	if (nmax > 0 && nbuf > nmax) nbuf = abuf = nmax;
+	return (nbuf);
+}
+
+/********************************************************************************
+ *	reads file *fn into memory, counts number of data points and
+ *	determines mean of data
+ *	the file is parsed only once, read_file() takes its values from memory
+ *	regular text files are mapped into memory and parsed in chunks on
+ *	(*cfg).nthreads threads, directly into the data buffer; binary files
+ *	are read as given by (*cfg).ifmt, hskip, nchan and interleave
+ *	if (*cfg).oocmem > 0, binary files are not loaded but read block by
+ *	block with read_block(); text files are always loaded
+ *	"-" is standard input; it and other pipes are read once, up to
+ *	(*cfg).maxread samples if that is > 0, and up to tmax if tmax >= 0:
+ *	tmax * fsamp samples, or by the time column of text input
  *										
  *	Parameters
- *		fn	name of file						
+ *		cfg	input file name, format, time column, columns A and B
  *		fs	sample frequency
- *		t	1 first column contains time in s
- *		A	number of column to process
- *		B	number of column to process in combination
  *		comma	if 1, then decimal point is a comma
  *										
  *	Returns
  * 		ndata	number of datapoints read
- *		mean	mean value of data points
+ *		mean	mean value of data points, 0 if (*cfg).submean is 0 or
+ *			the data are read block by block (block_read()), whose
+ *			mean calculate_lpsd_ooc() takes while it reads them
  ********************************************************************************
  	Naming convention	source code	publication
 				fs		f_s
 				ndata		N
  ********************************************************************************/
-void probe_file(char *fn, double *fs, int *ndata, double *mean, unsigned int t, unsigned int A, unsigned int B, int comma)
+void probe_file(tCFG *cfg, double *fs, long long *ndata, double *mean, int comma)
 {
-	int nread = 0;
-	double lasttime = 0.0;
-	char errmsg[200];
+	long long nread = -1, nmax = 0, i;
+	double tlim = -1;
+	int cached = 0, keyed = 0;
+	int nthreads = get_nthreads((*cfg).nthreads);
+	double dts, dt2s, sum;
+	struct stat st;
+	tCACHEHDR key, hdr;
+	char cfn[2 * FNLEN];
 	
 	*mean = 0.0;
-	timecol=t;
-	colA=A,
-	colB=B;
+	timecol=(*cfg).time;
+	decomma=comma;
+	colA=(*cfg).colA,
+	colB=(*cfg).colB;
 
-	/* open file */
-	ifp = fopen(fn, "r");
+	/* open file, a pipe may be open already from getNoC() */
+	if (ifp == 0)
+		ifp = open_input((*cfg).ifn, "r", 0);
 	if (ifp == 0)
-		gerror1("Error opening %s", fn);
+		gerror1("Error opening %s", (*cfg).ifn);
+	if (is_stream((*cfg).ifn)) {
+		nmax = (*cfg).maxread;
+		/* samples up to tmax, one more for the rounding of tmin and tmax */
+		i = (long long) floor((*cfg).tmax * (*cfg).fsamp) + 2;
+		if ((*cfg).tmax >= 0 && !timecol && (nmax <= 0 || i < nmax))
+			nmax = i;
+		if (timecol) tlim = (*cfg).tmax;
+	}
 	
 	/* select reading routine */
 	if ((timecol==1) & (colB>0)) read_data=read_t_A_B;
@@ -283,91 +938,180 @@ void probe_file(char *fn, double *fs, int *ndata, double *mean, unsigned int t,
 
 	if (read_data==NULL) gerror("No file reading routine selected!\n");
 
-	curtime = 0;
-	dts = 0;
-	dt2s = 0;
-	while (0 < read_lof(comma)) {
-		if (curline[0]!='#') {
-			if (1==read_data()) {
-				*mean += curdata;
-				if (nread > 0) {
-					dts += curtime - lasttime;
-					dt2s += (curtime - lasttime) * (curtime - lasttime);
-				}
-				lasttime = curtime;
-				nread++;
-			} else {
-				sprintf(errmsg,"Error reading file in data line %d\n",nread);
-				gerror(errmsg);
-			}	
+	nbuf = 0;
+	streamed = 0;
+	if (strcmp((*cfg).ifmt, "text") != 0)
+		nread = probe_binary((*cfg).ifn, (*cfg).ifmt, (*cfg).hskip, (*cfg).nchan,
+				     (*cfg).interleave, nthreads, (*cfg).oocmem > 0, (*cfg).compact, nmax, &dts, &dt2s);
+	else if (fstat(fileno(ifp), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+		if ((*cfg).cache) {
+			/* values of an earlier run from the sidecar */
+			memset(&key, 0, sizeof(key));
+			memcpy(key.magic, CACHEMAGIC, sizeof(key.magic));
+			key.size = (uint64_t) st.st_size;
+			key.mtime = (int64_t) st.st_mtim.tv_sec;
+			key.mtimens = (int64_t) st.st_mtim.tv_nsec;
+			key.time = timecol;
+			key.colA = colA;
+			key.colB = colB;
+			key.comma = (uint32_t) comma;
+			cache_name(cfn, (*cfg).ifn, (*cfg).cachedir, timecol, colA, colB);
+			keyed = 1;
+			data = (double *) cache_map(cfn, &key, &hdr, &bmap, &blen);
+			if (data != NULL) {
+				mapped = cached = 1;
+				nread = nbuf = abuf = hdr.ndata;
+				dts = hdr.dts;
+				dt2s = hdr.dt2s;
+			}
 		}
+		if (!cached)
+			nread = parse_mapped((*cfg).ifn, fileno(ifp), (size_t) st.st_size, nthreads, &dts, &dt2s);
 	}
+	if (nread < 0)
+		nread = parse_stream(nmax, tlim, &dts, &dt2s);
 
-	*mean = *mean / (double) nread;
+	if (cached) {
+		if ((*cfg).submean) *mean = hdr.mean;
+	} else if (cdata) {
+		if ((*cfg).submean) {
+			for (i = 0, sum = 0; i < nread; i++)
+				sum += compact_value(i);
+			*mean = sum / (double) nread;
+		}
+	} else if (!streamed && ((*cfg).submean || keyed)) {
+		for (i = 0, sum = 0; i < nread; i++)
+			sum += data[i];
+		if ((*cfg).submean) *mean = sum / (double) nread;
+		if (keyed) {
+			key.ndata = nread;
+			key.mean = sum / (double) nread;
+			key.dts = dts;
+			key.dt2s = dt2s;
+			cache_write(cfn, &key, data);
+		}
+	}
 	*ndata = nread;
 	*fs = (double) (nread - 1) / dts;
 	/* close file */
-	fclose(ifp);
+	if (ifp != stdin) fclose(ifp);
 	ifp = 0;
 }
 
 /********************************************************************************
- *	reads a data file into memory and multiplies by it by ulsb	
- *		ifn	name of file
+ *	selects nread values of the data loaded by probe_file(), subtracts
+ *	mean and multiplies them by ulsb
+ *	float64 data used in place from a binary file stay there if ulsb is 1
+ *	and mean is 0, otherwise they are copied
+ *	data that stay in a binary file are only selected here, read_block()
+ *	scales them when they are read
  *		ulsb	scaling factor to multiply data with						
  *		mean	mean value of data in file
- *		start	line number of first line to use (beginning with 0)
+ *		start	number of first data line to use (beginning with 0),
+ *			comment lines are not counted
  *		nread	number of lines to read
- *		comma	if 1, then the decimal point is a comma
  ********************************************************************************
  	Naming convention	source code	publication
 			 	nread 		N
  ********************************************************************************/
-void read_file(char *ifn, double ulsb, double mean, int start, int nread, int comma)
+void read_file(double ulsb, double mean, long long start, long long nread)
 {
-	int i;
-	int rslt;
+	long long i;
+	double *x;
 	
-	ifp = fopen(ifn, "r");
-	if (ifp == 0)
-		gerror1("Error opening %s", ifn);
-	data = (double *) xmalloc(nread * sizeof(double));
-	/* check if reading routine has been selected */
-	if (read_data==NULL) gerror("No file reading routine selected!\n");
+	/* check if the data have been loaded */
+	if (data==NULL && !streamed && !cdata) gerror("No data loaded, call probe_file first!\n");
+	if (start < 0 || nread > nbuf - start)
+		gerror("Not enough data in file for tmin and tmax!\n");
 
-	/* skip lines before start */
-	for (i = 0; i < start; i++) {
-		if (2==read_lof(comma)) start++;		/* when comment was read, read one more line */
+	/* converted block by block, or by the kernels */
+	if (streamed || cdata) {
+		sel_start = start;
+		sel_ulsb = ulsb;
+		sel_mean = mean;
+		return;
+	}
+
+	if (mapped) {
+		if (ulsb == 1 && mean == 0) {
+			data += start;
+			nbuf = abuf = nread;
+			return;
+		}
+		x = (double *) xmalloc((nread > 0 ? nread : 1) * sizeof(double));
+		for (i = 0; i < nread; i++)
+			x[i] = (data[start + i] - mean)*ulsb;
+		release_input();
+		mapped = 0;
+		data = x;
+		nbuf = abuf = nread;
+		return;
 	}
-	
-	/* read data into data array */
-	for (i = 0; i < nread; i++) {
-		rslt=read_lof(comma);
-		if (2==rslt) i--;				/* when comment was read, read one more line */
-		if (1==rslt) { 					/* if data was read, process it */
-			if (1==read_data())	
-				data[i] = (curdata - mean)*ulsb;
-		}	
-	}
-	fclose(ifp);
-	ifp = 0;
 
+	/* move the selected data to the front */
+	if (start > 0) memmove(data, data + start, nread * sizeof(double));
+	for (i = 0; i < nread; i++)
+		data[i] = (data[i] - mean)*ulsb;
+	data = (double *) xrealloc(data, nread * sizeof(double));
+	nbuf = abuf = nread;
 }
 
 /*
-	returns start address of data
+	returns start address of data, NULL if they are read by read_block()
+	or kept compact (get_compact())
 */
 double *get_data()
 {
-	return (&data[0]);
+	return ((streamed || cdata) ? NULL : &data[0]);
+}
+
+/*
+	returns the start of the data selected by read_file() if they are kept
+	in the format of the input, and their type in *type; NULL otherwise
+*/
+const void *get_compact(int *type)
+{
+	if (cdata == 0) return (NULL);
+	*type = ctype;
+	return (cdata + (size_t) sel_start * bfmt->size);
+}
+
+/*
+	copies the values start..start+n-1 of the data selected by read_file()
+	to x, for data that are read block by block
+*/
+void read_block(double *x, long long start, long long n)
+{
+	long long i;
+
+	if (!streamed) {
+		memcpy(x, data + start, n * sizeof(double));
+		return;
+	}
+	for (i = 0; i < n; i++)
+		x[i] = (binary_value(sel_start + start + i) - sel_mean)*sel_ulsb;
+}
+
+/* returns 1 if the data are read block by block by read_block() */
+int block_read()
+{
+	return (streamed);
 }
 
 void close_file()
 {
-	if (0 != ifp)
+	if (0 != ifp && stdin != ifp)
 		fclose(ifp);
-	if (0 != data)
+	if (!mapped && 0 != data)
 		xfree(data);
+	if (cdata && cown)
+		xfree((void *) cdata);
+	cdata = 0;
+	release_input();
+	data = 0;
+	mapped = 0;
+	streamed = 0;
+	nbuf = abuf = 0;
 }
 
 /*
@@ -461,7 +1205,7 @@ static void writeData(FILE *ofp, tCFG * cfg, tDATA * data, tGNUTERM * gt) {
 				fprintf(ofp, "%.18e	", (*data).ps[i]);
 				break;
 			case 'N':
-				fprintf(ofp, "%d	", (*data).avg[i]);
+				fprintf(ofp, "%lld	", (*data).avg[i]);
 				break;
 			case 'u':
 				fprintf(ofp, "%.18e	", sqrt((*data).varpsd[i]));
@@ -476,8 +1220,11 @@ static void writeData(FILE *ofp, tCFG * cfg, tDATA * data, tGNUTERM * gt) {
 				fprintf(ofp, "%.18e	", (*data).varps[i]);
 				break;
 			case 'R':
-				fprintf(ofp, "%e	",
-					(*cfg).fsamp / (double) (*data).nffts[i]);
+				if ((*data).rbw != NULL)
+					fprintf(ofp, "%e	", (*data).rbw[i]);
+				else
+					fprintf(ofp, "%e	",
+						(*cfg).fsamp / (double) (*data).nffts[i]);
 				break;
 			case 'b':
 				fprintf(ofp, "%e	", (*data).bins[i]);
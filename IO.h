@@ -2,11 +2,15 @@
 #define __IO_h
 
 int exists(char *fn);
+int is_stream(char *fn);
 int getNoC(char *fn, int *comma);
-void probe_file(char *fn, double *fs, int *ndata, double *mean, unsigned int t, unsigned int A, unsigned int B, int comma);
-void read_file(char *ifn, double ulsb, double mean, int start, int nread, int comma);
+void probe_file(tCFG *cfg, double *fs, long long *ndata, double *mean, int comma);
+void read_file(double ulsb, double mean, long long start, long long nread);
 void close_file();
 double *get_data();
+const void *get_compact(int *type);
+void read_block(double *x, long long start, long long n);
+int block_read();
 void saveResult(tCFG * cfg, tDATA * data, tGNUTERM * gt, tWinInfo *wi, int argc, char *argv[]);
 int write_gnufile(char *gfn, char *ofn, char *vfn, char *ifn, char *s, 
 			double fmin, double fmax, double dmin, double dmax,
@@ -88,7 +88,9 @@ void basename(char *s, char *base) {
 void parse_fgsC(char *s, char *ifn, char *par, unsigned int A, unsigned int B) {
 	char ifnb[FNLEN];
 	char C[FNLEN];
+	char stdn[] = "stdin";
 
+	if (strcmp(ifn, "-") == 0) ifn = stdn;	/* output names for standard input */
 	basename(ifn, ifnb);			/* copy input file basename to ifnb */
 	if (B==0) sprintf(C,"%d",A);
 	else sprintf(C,"%d-%d",B,A);
@@ -0,0 +1,132 @@
+/********************************************************************************
+    cache.c
+
+    binary sidecar of a parsed text input file
+
+    The sidecar holds the values selected from the input file (column A,
+    or column B - column A) as native doubles after a header with the
+    mean and the time statistics of probe_file(). It is valid as long as
+    size and modification time of the input file and the selection of
+    time column, columns and decimal comma are those in its header; a
+    later run maps it into memory instead of parsing the text again.
+
+    The sidecar lies next to the input file, or in a cache directory with
+    a hash of the full path of the input file in its name. It is written
+    to a temporary file that is renamed when complete, so that a run never
+    sees half a sidecar.
+ ********************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include "config.h"
+#include "errors.h"
+#include "cache.h"
+
+/* FNV-1a hash of s */
+static uint64_t
+hash (const char *s)
+{
+  uint64_t h = 14695981039346656037ull;
+
+  for (; *s; s++)
+    h = (h ^ (unsigned char) *s) * 1099511628211ull;
+  return h;
+}
+
+/*
+	name of the sidecar of ifn for the selection of columns
+	dir	cache directory, next to ifn if empty
+	dest must hold 2*FNLEN characters
+*/
+void
+cache_name (char *dest, const char *ifn, const char *dir,
+	    unsigned int time, unsigned int colA, unsigned int colB)
+{
+  char path[PATH_MAX];
+  const char *base;
+
+  if (dir[0] == 0)
+    {
+      snprintf (dest, 2 * FNLEN, "%s.%u-%u-%u.lpsdc", ifn, time, colA, colB);
+      return;
+    }
+  if (realpath (ifn, path) == NULL)
+    snprintf (path, sizeof (path), "%s", ifn);
+  base = strrchr (ifn, '/');
+  base = (base != NULL) ? base + 1 : ifn;
+  snprintf (dest, 2 * FNLEN, "%s/%s.%016llx.%u-%u-%u.lpsdc", dir, base,
+	    (unsigned long long) hash (path), time, colA, colB);
+}
+
+/*
+	maps the sidecar name if its header matches key in size, mtime,
+	time column, columns and comma
+	returns its values and copies its header to *hdr, the mapping to
+	*map and *len; NULL if there is no valid sidecar
+*/
+const double *
+cache_map (const char *name, const tCACHEHDR * key, tCACHEHDR * hdr,
+	   const char **map, size_t * len)
+{
+  struct stat st;
+  const char *m;
+  int fd;
+
+  fd = open (name, O_RDONLY);
+  if (fd < 0)
+    return NULL;
+  if (fstat (fd, &st) != 0 || (size_t) st.st_size < sizeof (tCACHEHDR))
+    {
+      close (fd);
+      return NULL;
+    }
+  m = (const char *) mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (m == MAP_FAILED)
+    return NULL;
+  memcpy (hdr, m, sizeof (tCACHEHDR));
+  if (memcmp (hdr->magic, CACHEMAGIC, sizeof (hdr->magic)) != 0
+      || hdr->size != key->size || hdr->mtime != key->mtime
+      || hdr->mtimens != key->mtimens || hdr->time != key->time
+      || hdr->colA != key->colA || hdr->colB != key->colB
+      || hdr->comma != key->comma || hdr->ndata < 0
+      || (size_t) st.st_size != sizeof (tCACHEHDR) + hdr->ndata * sizeof (double))
+    {
+      munmap ((void *) m, st.st_size);
+      return NULL;
+    }
+  *map = m;
+  *len = st.st_size;
+  return (const double *) (m + sizeof (tCACHEHDR));
+}
+
+/* writes the sidecar name with the header hdr and the values x */
+void
+cache_write (const char *name, const tCACHEHDR * hdr, const double *x)
+{
+  char tmp[2 * FNLEN + 32];
+  FILE *fp;
+  int ok;
+
+  snprintf (tmp, sizeof (tmp), "%s.%ld.tmp", name, (long) getpid ());
+  fp = fopen (tmp, "wb");
+  if (fp == NULL)
+    {
+      message1 ("\tWARNING: cannot write cache file %s", name);
+      return;
+    }
+  ok = (fwrite (hdr, sizeof (tCACHEHDR), 1, fp) == 1)
+    && (fwrite (x, sizeof (double), hdr->ndata, fp) == (size_t) hdr->ndata);
+  ok = (fclose (fp) == 0) && ok;
+  if (!ok || rename (tmp, name) != 0)
+    {
+      unlink (tmp);
+      message1 ("\tWARNING: cannot write cache file %s", name);
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef __cache_h
+#define __cache_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CACHEMAGIC "LPSDC01"	/* identifies a sidecar, with the version */
+
+/* header of a sidecar, followed by ndata doubles */
+typedef struct
+{
+  char magic[8];		/* CACHEMAGIC */
+  uint64_t size;		/* size of the input file in bytes */
+  int64_t mtime;		/* its modification time, s */
+  int64_t mtimens;		/* and ns */
+  uint32_t time;		/* 1 if column 1 is time */
+  uint32_t colA;		/* columns the values were taken from */
+  uint32_t colB;
+  uint32_t comma;		/* 1 if comma was the decimal point */
+  int64_t ndata;		/* number of values */
+  double mean;			/* mean of the values */
+  double dts;			/* sums of delta t's and delta t^2's */
+  double dt2s;
+} tCACHEHDR;
+
+void cache_name (char *dest, const char *ifn, const char *dir,
+		 unsigned int time, unsigned int colA, unsigned int colB);
+const double *cache_map (const char *name, const tCACHEHDR * key,
+			 tCACHEHDR * hdr, const char **map, size_t * len);
+void cache_write (const char *name, const tCACHEHDR * hdr, const double *x);
+
+#endif
@@ -69,12 +69,31 @@ static void act_colA(char *s);
 static void act_colB(char *s);
 static void act_format(char *s);
 static void act_gnuterm(char *s);
+static void act_nthreads(char *s);
+static void act_wincache(char *s);
+static void act_tfnfft(char *s);
+static void act_sdft(char *s);
+static void act_decatt(char *s);
+static void act_ifmt(char *s);
+static void act_hskip(char *s);
+static void act_nchan(char *s);
+static void act_interleave(char *s);
+static void act_submean(char *s);
+static void act_cache(char *s);
+static void act_cachedir(char *s);
+static void act_oocmem(char *s);
+static void act_maxread(char *s);
+static void act_compact(char *s);
+static void act_rigor(char *s);
+static void act_plan(char *s);
+static void act_gridtol(char *s);
 
 static tPARSEPAIR pplist [] = {
 	{"IFN",		act_ifn},
 	{"OFN",		act_ofn},
 	{"GFN",		act_gfn},
 	{"WFN",		act_wfn},
+	{"CACHEDIR",	act_cachedir},
 	{"WT",		act_wt},
 	{"NSPEC",	act_nspec},
 	{"LR",		act_lr},
@@ -95,7 +114,24 @@ static tPARSEPAIR pplist [] = {
 	{"COLA",	act_colA},
 	{"COLB",	act_colB},
 	{"FORMAT",	act_format},
-	{"GNUTERM",	act_gnuterm}
+	{"GNUTERM",	act_gnuterm},
+	{"NTHREADS",	act_nthreads},
+	{"WINCACHE",	act_wincache},
+	{"TFNFFT",	act_tfnfft},
+	{"SDFT",	act_sdft},
+	{"DECATT",	act_decatt},
+	{"IFMT",	act_ifmt},
+	{"HSKIP",	act_hskip},
+	{"NCHAN",	act_nchan},
+	{"INTERLEAVE",	act_interleave},
+	{"SUBMEAN",	act_submean},
+	{"CACHE",	act_cache},
+	{"OOCMEM",	act_oocmem},
+	{"MAXREAD",	act_maxread},
+	{"COMPACT",	act_compact},
+	{"PLANRIGOR",	act_rigor},
+	{"PLAN",	act_plan},
+	{"GRIDTOL",	act_gridtol}
 };
 
 static const int npplist = sizeof (pplist) / sizeof (tPARSEPAIR);
@@ -160,7 +196,25 @@ static tCFG cfg={usedefs:0,
 		colA:1,
 		askcolA:1,
 		colB:0,
-		askcolB:0};
+		askcolB:0,
+		nthreads:DEFNTHREADS,
+		wincache:DEFWINCACHE,
+		tfnfft:DEFTFNFFT,
+		sdft:DEFSDFT,
+		decatt:DEFDECATT,
+		ifmt:DEFIFMT,
+		hskip:DEFHSKIP,
+		nchan:DEFNCHAN,
+		interleave:DEFINTERLEAVE,
+		submean:DEFSUBMEAN,
+		cache:DEFCACHE,
+		cachedir:DEFCACHEDIR,
+		oocmem:DEFOOCMEM,
+		maxread:DEFMAXREAD,
+		compact:DEFCOMPACT,
+		rigor:DEFRIGOR,
+		plan:DEFPLAN,
+		gridtol:DEFGRIDTOL};
 
 void getConfig(tCFG *c) {
 	memcpy(c,&cfg,sizeof(cfg));
@@ -334,6 +388,78 @@ static void act_fmax(char *s) {
 	else cfg.askfmax=0;
 }
 
+static void act_nthreads(char *s) {
+	cfg.nthreads=getIntValue(s);
+}
+
+static void act_wincache(char *s) {
+	cfg.wincache=getDBLValue(s);
+}
+
+static void act_tfnfft(char *s) {
+	cfg.tfnfft=getIntValue(s);
+}
+
+static void act_sdft(char *s) {
+	cfg.sdft=getIntValue(s);
+}
+
+static void act_decatt(char *s) {
+	cfg.decatt=getDBLValue(s);
+}
+
+static void act_ifmt(char *s) {
+	getStringValue(cfg.ifmt,s);
+}
+
+static void act_hskip(char *s) {
+	cfg.hskip=getIntValue(s);
+}
+
+static void act_nchan(char *s) {
+	cfg.nchan=getIntValue(s);
+}
+
+static void act_interleave(char *s) {
+	cfg.interleave=getIntValue(s);
+}
+
+static void act_submean(char *s) {
+	cfg.submean=getIntValue(s);
+}
+
+static void act_cache(char *s) {
+	cfg.cache=getIntValue(s);
+}
+
+static void act_cachedir(char *s) {
+	getStringValue(cfg.cachedir,s);
+}
+
+static void act_oocmem(char *s) {
+	cfg.oocmem=getDBLValue(s);
+}
+
+static void act_maxread(char *s) {
+	cfg.maxread=(long long) getDBLValue(s);
+}
+
+static void act_compact(char *s) {
+	cfg.compact=getIntValue(s);
+}
+
+static void act_rigor(char *s) {
+	getStringValue(cfg.rigor,s);
+}
+
+static void act_plan(char *s) {
+	cfg.plan=getIntValue(s);
+}
+
+static void act_gridtol(char *s) {
+	cfg.gridtol=getDBLValue(s);
+}
+
 static void act_format(char *s) {
 	getStringValue(&gt[gti].fmt[0],s);
 }
@@ -464,20 +590,23 @@ static void printData(char *dest, tCFG cfg, tDATA data) {
 sprintf(&dest[strlen(dest)],"---Data--------------------------------------------------------------------\n");
 	sprintf(&dest[strlen(dest)],"Regression: %s\t",yn[cfg.LR]);
 	sprintf(&dest[strlen(dest)],"Fsamp (Hz): %.2e\t",cfg.fsamp);
-	sprintf(&dest[strlen(dest)],"NDATA (samples): %d\n",data.ndata);
+	sprintf(&dest[strlen(dest)],"NDATA (samples): %lld\n",data.ndata);
 	sprintf(&dest[strlen(dest)],"Tmin (s): %.1f\t",cfg.tmin);
 	sprintf(&dest[strlen(dest)],"Tmax (s): %.1f\t",cfg.tmax);
-	sprintf(&dest[strlen(dest)],"Read (samples): %d\n",data.nread);
-	sprintf(&dest[strlen(dest)],"Mean: %.2e\t",data.mean);
+	sprintf(&dest[strlen(dest)],"Read (samples): %lld\n",data.nread);
+	if (data.blockmean) sprintf(&dest[strlen(dest)],"Mean: taken while reading\t");
+	else if (cfg.submean) sprintf(&dest[strlen(dest)],"Mean: %.2e\t",data.mean);
+	else sprintf(&dest[strlen(dest)],"Mean: not subtracted\t");
 	sprintf(&dest[strlen(dest)],"Scaling factor: %.3e\t",cfg.ulsb);
-	sprintf(&dest[strlen(dest)],"Time column: %s\n",yn[cfg.time]);
+	sprintf(&dest[strlen(dest)],"Time column: %s\t",yn[cfg.time]);
+	sprintf(&dest[strlen(dest)],"Input format: %s\n",cfg.ifmt);
 	if (cfg.colB==0) sprintf(&dest[strlen(dest)],"Column: %d\n",cfg.colA);
 	else sprintf(&dest[strlen(dest)],"Columns: %d-%d\n",cfg.colB,cfg.colA);
 }
 
 static void printOutput(char *dest, tCFG cfg, tGNUTERM gt, tDATA data) {
-	char meth[2][SLEN]={"LPSD","FFTW"};
-	int avg;
+	char meth[3][SLEN]={"LPSD","FFTW","FFTW in log bands"};
+	long long avg;
 
 	avg=floor((data.nread-cfg.nfft)/(cfg.ovlp/100.)/cfg.nfft+1);
 sprintf(&dest[strlen(dest)],"---Output------------------------------------------------------------------\n");
@@ -488,8 +617,17 @@ sprintf(&dest[strlen(dest)],"---Output------------------------------------------
 	if (cfg.METHOD==0) {
 		sprintf(&dest[strlen(dest)],"min. avgs: %d\t\t",cfg.minAVG);
 		sprintf(&dest[strlen(dest)],"des. avgs: %d\n",cfg.desAVG);
-	} else if (cfg.METHOD==1) {
-		sprintf(&dest[strlen(dest)],"avgs: %d\t\t",avg);
+		if (cfg.gridtol>0) {
+			sprintf(&dest[strlen(dest)],"Grid tol. (%%): %.2f",cfg.gridtol);
+			/* known after calc_params(), i.e. in the output file only */
+			if (data.ngrid>0) {
+				sprintf(&dest[strlen(dest)],"\tnfft values: %d\t",data.ngrid);
+				sprintf(&dest[strlen(dest)],"max. RBW dev. (%%): %.3f",100.*data.gridrbw);
+			}
+			sprintf(&dest[strlen(dest)],"\n");
+		}
+	} else if (cfg.METHOD==1 || cfg.METHOD==2) {
+		sprintf(&dest[strlen(dest)],"avgs: %lld\t\t",avg);
 		sprintf(&dest[strlen(dest)],"Fres (Hz): %.1e\n",cfg.fres);
 	}
 	sprintf(&dest[strlen(dest)],"Gnuplot terminal: %s\n",gt.identifier);
@@ -22,12 +22,31 @@
 #define DEFDESAVG 100		/* desired number of averages */
 #define DEFMINAVG 10		/* minimum number of averages */
 #define DEFSBIN -1		/* use smallest bin given by window function */
-#define DEFMETHOD 0		/* METHOD to calculate frequency METHOD */
+#define DEFMETHOD 0		/* METHOD to calculate frequency METHOD: 0 LPSD, 1 FFT, 2 FFT in log bands */
 #define DEFFSAMP 1e4		/* lpsd.c	- default sampling frequency */
 #define DEFNSPEC 500		/* lpsd.c	- default number of frequencies in spectrum */
+#define DEFNTHREADS 0		/* lpsd.c	- number of worker threads, 0: one per online processor */
+#define DEFWINCACHE 256		/* wincache.c	- memory budget of window table cache in MB */
+#define DEFTFNFFT 1048576	/* lpsd.c	- smallest nfft for the table-free kernel, 0: never */
+#define DEFSDFT 1		/* lpsd.c	- sliding DFT for cosine-sum windows: 0 never, 1 if cheaper, 2 always */
+#define DEFDECATT 0		/* decimate.c	- stopband attenuation of the decimation filters in dB, 0: no decimation */
+#define DEFIFMT "text"		/* IO.c		- input format: text, npy, i16le, i16be, i32le, i32be, f32le, f32be, f64le, f64be */
+#define DEFHSKIP 0		/* IO.c		- bytes to skip at the beginning of raw binary files */
+#define DEFNCHAN 1		/* IO.c		- number of channels in raw binary files */
+#define DEFINTERLEAVE 1		/* IO.c		- 1: channels interleaved sample by sample, 0: one block per channel */
+#define DEFSUBMEAN 1		/* IO.c		- 1: subtract the mean of the data, 0: do not */
+#define DEFCACHE 0		/* cache.c	- 1: keep parsed text input in a binary sidecar, 0: do not */
+#define DEFCACHEDIR ""		/* cache.c	- directory of the sidecars, empty: next to the input file */
+#define DEFOOCMEM 0		/* lpsd.c	- memory budget for the time series in MB, 0: keep it all in memory */
+#define DEFMAXREAD 0		/* IO.c		- most samples read from stdin or a pipe, 0: until the end of the input */
+#define DEFCOMPACT 1		/* IO.c		- 1: keep int16, int32, float32 input samples in memory as they are, 0: as double */
+#define DEFRIGOR "estimate"	/* fftplan.c	- FFTW planning rigor: estimate, measure, patient, exhaustive */
+#define DEFPLAN 0		/* lpsd.c	- print the kernel plan: 0 no, 1 per kernel, 2 also every task */
+#define DEFGRIDTOL 0		/* lpsd.c	- grid mode: largest change of nfft in %, 0: no grid mode */
 
 #define DATADEL " \t\n"		/* IO.c		- delimiters in datafiles: space, tab, and newline *** 28.06.2007 newline added */
 #define DATALEN 1000		/* IO.c		- length of a single line in ASCII data files */
+#define CHUNKLEN 4194304	/* IO.c		- bytes per chunk of the parallel parser */
 #define MAXGNUTERM 100		/* max. number of plot environments */
 #define FNLEN 256		/* lpsd.c	- length of filename strings */
 #define CMTLEN 5000		/* lpsd.c	- length of gnuplot comments */
@@ -74,7 +93,7 @@ typedef struct {
 	unsigned short int askWT;
 	int LR;				/* 0 no linear regression, 1 perform linear regression */
 	int nspec;			/* number of samples in spectrum */
-	int nfft;			/* FFTW: dimension of FFT */
+	long long nfft;			/* FFTW: dimension of FFT */
 	unsigned short int asknspec;
 	double fsamp;			/* sampling frequency */
 	unsigned short int askfsamp;
@@ -118,6 +137,24 @@ typedef struct {
 	unsigned short int askcolA;
 	unsigned int colB;		/* process column B if B>0 & B>A */
 	unsigned short int askcolB;	
+	int nthreads;			/* number of worker threads, 0: one per online processor */
+	double wincache;		/* memory budget of window table cache in MB */
+	int tfnfft;			/* smallest nfft for the table-free kernel, 0: never */
+	int sdft;			/* sliding DFT: 0 never, 1 if cheaper, 2 always */
+	double decatt;			/* stopband attenuation of the decimation filters in dB, 0: no decimation */
+	char ifmt[SLEN];		/* input format, text, npy or a raw binary sample format */
+	int hskip;			/* bytes to skip at the beginning of raw binary files */
+	int nchan;			/* number of channels in raw binary files */
+	int interleave;			/* 1: channels interleaved sample by sample, 0: one block per channel */
+	int submean;			/* 1: subtract the mean of the data, 0: do not */
+	int cache;			/* 1: keep parsed text input in a binary sidecar, 0: do not */
+	char cachedir[FNLEN];		/* directory of the sidecars, empty: next to the input file */
+	double oocmem;			/* memory budget for the time series in MB, 0: keep it all in memory */
+	long long maxread;		/* most samples read from stdin or a pipe, 0: until the end of the input */
+	int compact;			/* 1: keep int16, int32, float32 input samples in memory as they are, 0: as double */
+	char rigor[SLEN];		/* FFTW planning rigor: estimate, measure, patient, exhaustive */
+	int plan;			/* print the kernel plan: 0 no, 1 per kernel, 2 also every task */
+	double gridtol;			/* grid mode: largest change of nfft in %, 0: no grid mode */
 } tCFG;	
 
 typedef struct {
@@ -129,13 +166,17 @@ typedef struct {
 	double *varpsd;			/* variance of power spectral density */
 	double *fft_ps;			/* FFTW: complete power spectrum of FFTW */
 	double *fft_varps;		/* FFTW: complete variance of power spectrum of FFTW */
-	int *avg;			/* debug information: number of averages */
-	int *nffts;			/* list of nffts for DFTs */
+	long long *avg;			/* debug information: number of averages */
+	long long *nffts;		/* list of nffts for DFTs */
+	double *rbw;			/* METHOD 2: resolution bandwidth of every band, NULL otherwise */
 	int NoC;			/* number of columns in data file */
 	double mean;			/* mean value of input data */
-	int ndata;			/* number of data in input file */
-	int nread;			/* length of time series used for spectrum estimation */
+	int blockmean;			/* 1 - mean still to be taken while the blocks are read (out-of-core) */
+	long long ndata;		/* number of data in input file */
+	long long nread;		/* length of time series used for spectrum estimation */
 	int comma;			/* 1 - comma as decimal delimiter; 0 - decimal points */
+	int ngrid;			/* grid mode: number of distinct nfft */
+	double gridrbw;			/* grid mode: largest relative change of the resolution bandwidth */
 
 } tDATA;
 
@@ -0,0 +1,231 @@
+/********************************************************************************
+    decimate.c
+
+    pyramid of 2x decimated copies of the time series for low-frequency bins
+
+    Level l holds the series at the sampling frequency fsamp/2^l; sample m
+    of level l+1 is the half-band filtered level l at sample 2m. A bin whose
+    frequency plus window bandwidth lies in the passband of level l can be
+    computed there with nfft/2^l points and the same number of segments,
+    i.e. with 2^l times less work.
+
+    The half-band filters are Kaiser-windowed sinc filters with the stopband
+    attenuation att (dB) and a transition band of DECTRANS times their input
+    rate, centered at a quarter of it. The passband of level l therefore
+    ends at (0.5 - DECTRANS)*fsamp/2^l, and everything above the stopband
+    edge that is aliased into it is attenuated by att dB. Every second tap
+    is zero, the filter needs about (att-8)/(57*DECTRANS) multiplications
+    per output sample.
+
+    The passband ripple of a Kaiser design is about the stopband ripple
+    delta = 10^(-att/20) (decimate_ripple()). A PSD computed on level l is
+    thus biased by at most about 2*l*delta relative, e.g. 2e-5*l for
+    att = 100 dB, plus aliased power suppressed by att dB. The filter gain
+    at DC is exactly 1.
+
+    Beyond the ends, the series is continued by the least-squares line
+    through its DECFIT*ntaps end samples. The symmetric filters map a
+    straight line onto itself, so a linear trend passes without error, and
+    the end samples are filtered like all others. (Point reflection about
+    the end sample would return that sample unfiltered on every level,
+    where its full-band noise disturbs the linear regression of the
+    segments at the ends.)
+
+    The levels of a compact series are doubles in its raw units, with its
+    ulsb and mean; level 0 is converted to doubles only while the pyramid
+    is built.
+ ********************************************************************************/
+#include <stdlib.h>
+#include <math.h>
+#include "misc.h"
+#include "netlibi0.h"
+#include "decimate.h"
+
+/* Kaiser's beta for the stopband attenuation att (dB) */
+static double
+kaiser_beta (double att)
+{
+  if (att > 50)
+    return 0.1102 * (att - 8.7);
+  if (att > 21)
+    return 0.5842 * pow (att - 21, 0.4) + 0.07886 * (att - 21);
+  return 0;
+}
+
+/*
+	designs the half-band filter for the stopband attenuation att (dB)
+	h(0) = 1/2, h(+-(2p-1)) = g[p-1] for p = 1..ntaps, h = 0 otherwise
+
+	returns ntaps, *g is allocated here
+*/
+static int
+halfband (double att, double **g)
+{
+  int ntaps, M, p, k;
+  double beta, sum;
+
+  /* Kaiser: filter length - 1 = (att - 7.95) / (2.285 * 2 * pi * width) */
+  M = (int) ceil ((att - 7.95) / (2.285 * 2 * M_PI * DECTRANS) / 2);
+  if (M % 2 == 0)
+    M++;
+  ntaps = (M + 1) / 2;
+  beta = kaiser_beta (att);
+
+  *g = (double *) xmalloc (ntaps * sizeof (double));
+  for (p = 1, sum = 0; p <= ntaps; p++)
+    {
+      k = 2 * p - 1;
+      (*g)[p - 1] = ((p % 2) ? 1 : -1) / (M_PI * k)
+	* netlibi0 (beta * sqrt (1 - (double) k * k / ((double) M * M)))
+	/ netlibi0 (beta);
+      sum += (*g)[p - 1];
+    }
+  /* unit gain at DC */
+  for (p = 0; p < ntaps; p++)
+    (*g)[p] *= 0.25 / sum;
+  return ntaps;
+}
+
+/*
+	least-squares line through x[0..k-1]
+	line[0] is its value at index t, line[1] its slope
+*/
+static void
+fit_line (const double *x, long long k, double t, double *line)
+{
+  double ic = 0.5 * (k - 1), mx = 0, sxy = 0, sxx = 0;
+  long long i;
+
+  for (i = 0; i < k; i++)
+    mx += x[i];
+  mx /= k;
+  for (i = 0; i < k; i++)
+    {
+      sxy += (i - ic) * (x[i] - mx);
+      sxx += (i - ic) * (i - ic);
+    }
+  line[1] = sxx > 0 ? sxy / sxx : 0;
+  line[0] = mx + line[1] * (t - ic);
+}
+
+/*
+	x[j] for any j, continued by the lines lo through x[0] and hi through
+	x[n-1] (value at the end sample and slope)
+*/
+static double
+at (const double *x, long long n, long long j, const double *lo,
+    const double *hi)
+{
+  if (j < 0)
+    return lo[0] + lo[1] * j;
+  if (j >= n)
+    return hi[0] + hi[1] * (j - (n - 1));
+  return x[j];
+}
+
+/* number of samples of level l for n samples of level 0 */
+long long
+decimate_length (long long n, int l)
+{
+  for (; l > 0; l--)
+    n = (n + 1) / 2;
+  return n;
+}
+
+/* filters x[0..n-1] with the half-band filter and keeps every second sample */
+static double *
+decimate2 (const double *x, long long n, const double *g, int ntaps,
+	   long long *nout)
+{
+  double *y;
+  double sum, lo[2], hi[2];
+  long long m, j, m0, m1, k;
+  int p;
+
+  *nout = (n + 1) / 2;
+  y = (double *) xmalloc (*nout * sizeof (double));
+
+  /* lines that continue the series beyond its ends */
+  k = DECFIT * ntaps < n ? DECFIT * ntaps : n;
+  fit_line (x, k, 0, lo);
+  fit_line (x + n - k, k, k - 1, hi);
+
+  /* outputs whose filter lies inside the data */
+  m0 = ntaps;
+  m1 = (n - 2 * ntaps) / 2;
+  for (m = 0; m < *nout; m++)
+    {
+      j = 2 * m;
+      sum = 0;
+      if (m >= m0 && m < m1)
+	for (p = 0; p < ntaps; p++)
+	  sum += g[p] * (x[j - 2 * p - 1] + x[j + 2 * p + 1]);
+      else
+	for (p = 0; p < ntaps; p++)
+	  sum += g[p] * (at (x, n, j - 2 * p - 1, lo, hi)
+			 + at (x, n, j + 2 * p + 1, lo, hi));
+      y[m] = 0.5 * x[j] + sum;
+    }
+  return y;
+}
+
+/*
+	builds levels 1..nlev below the series of dt0 with the stopband
+	attenuation att (dB), every level with its detrend index for LR
+*/
+tPYRAMID *
+pyramid_build (const tDTIDX * dt0, int nlev, double att, int LR)
+{
+  tPYRAMID *p;
+  double *g, *x0 = NULL;
+  long long n;
+  int l;
+
+  p = (tPYRAMID *) xmalloc (sizeof (tPYRAMID));
+  n = dt0->n;
+  if (dt0->x == NULL)
+    {
+      x0 = (double *) xmalloc (n * sizeof (double));
+      smp_block (dt0, 0, n, x0);
+    }
+  p->x[0] = x0 ? x0 : (double *) dt0->x;
+  p->dt[0] = dt0;
+  p->ntaps = halfband (att, &g);
+
+  for (l = 1; l <= nlev && l <= DECMAXLEV && n > 2 * p->ntaps + 1; l++)
+    {
+      p->x[l] = decimate2 (p->x[l - 1], n, g, p->ntaps, &n);
+      p->dt[l] = detrend_index_raw (p->x[l], SMP_F64, dt0->ulsb, dt0->mean,
+				    n, LR);
+    }
+  if (x0)
+    {
+      xfree (x0);
+      p->x[0] = NULL;
+    }
+  p->nlev = l;
+  xfree (g);
+  return p;
+}
+
+void
+pyramid_free (tPYRAMID * p)
+{
+  int l;
+
+  if (p == NULL)
+    return;
+  for (l = 1; l < p->nlev; l++)
+    {
+      detrend_free ((tDTIDX *) p->dt[l]);
+      xfree (p->x[l]);
+    }
+  xfree (p);
+}
+
+/* passband ripple (relative amplitude) of one half-band filter */
+double
+decimate_ripple (double att)
+{
+  return pow (10, -att / 20);
+}
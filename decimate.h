@@ -0,0 +1,26 @@
+#ifndef __decimate_h
+#define __decimate_h
+
+#include "detrend.h"
+
+#define DECMAXLEV 24		/* max. number of decimation levels */
+#define DECTRANS 0.1		/* width of the transition band of the half-band
+				   filters relative to their input rate */
+#define DECFIT 4		/* end samples per filter tap for the lines that
+				   continue the series beyond its ends */
+
+typedef struct
+{
+  int nlev;			/* number of levels, level 0 is the input */
+  double *x[DECMAXLEV + 1];	/* time series of level l, x[0] not owned,
+				   NULL for a compact series */
+  const tDTIDX *dt[DECMAXLEV + 1];	/* their detrend indices, dt[0] not owned */
+  int ntaps;			/* nonzero taps of the filter besides the center */
+} tPYRAMID;
+
+tPYRAMID *pyramid_build (const tDTIDX * dt0, int nlev, double att, int LR);
+void pyramid_free (tPYRAMID * p);
+double decimate_ripple (double att);
+long long decimate_length (long long n, int l);
+
+#endif
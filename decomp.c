@@ -0,0 +1,583 @@
+/********************************************************************************
+    decomp.c
+
+    compressed input files and pipes: gzip, xz and zstd, recognized by
+    their magic bytes
+
+    Each format needs its library at build time, selected by HAVE_ZLIB,
+    HAVE_LZMA and HAVE_ZSTD ('make COMPRESS="gzip xz zstd"'); input in a
+    format that is not built in is an error.
+
+    decomp_buffer() decompresses a whole file in memory, in parallel
+    where the compressed data tell how long the output of each part is:
+      gzip	BGZF files (bgzip): members of at most 64 kB with their
+		compressed length in an extra field and their uncompressed
+		length in the trailer
+      zstd	several frames (pzstd, or frames compressed separately and
+		concatenated); into a buffer per part if the frames do not
+		record their content size
+      xz	several blocks (xz -T), by the threaded decoder of liblzma
+		5.4 and later
+    Everything else is decompressed by one thread: a single gzip member,
+    as written by gzip and pigz, and a single zstd frame, as written by
+    the zstd tool even with -T, cannot be split.
+
+    decomp_fopen() returns a stdio stream that decodes a pipe while it is
+    read, so the line reader and the binary loader read it as before.
+ ********************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <sys/types.h>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_LZMA
+#include <lzma.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#include "config.h"
+#include "misc.h"
+#include "errors.h"
+#include "workpool.h"
+#include "decomp.h"
+
+#define DCPART 4194304		/* compressed bytes of a parallel task, at least */
+#define DCBUF 262144		/* bytes read from a pipe at a time */
+#define DCSTEP 1073741824	/* largest buffer passed to zlib at once */
+#define DCUNKNOWN ((size_t) -1)	/* output length of a part that is not recorded */
+
+static const char *dcnames[] = { "uncompressed", "gzip", "xz", "zstd" };
+
+/* decoder of one of the formats */
+typedef struct
+{
+  int fmt;
+  int done;			/* 1 if the data so far end with a whole member, stream or frame */
+#ifdef HAVE_ZLIB
+  z_stream z;
+#endif
+#ifdef HAVE_LZMA
+  lzma_stream x;
+#endif
+#ifdef HAVE_ZSTD
+  ZSTD_DStream *zs;
+#endif
+} tDEC;
+
+/* part of a file that one task decompresses */
+typedef struct
+{
+  int fmt;
+  const char *in;		/* compressed data */
+  size_t inlen;
+  char *out;			/* where their output goes */
+  size_t outlen;		/* and its length, DCUNKNOWN if not known in advance */
+  int bad;			/* 1 if they did not give outlen bytes */
+  const char *fn;		/* name of the file */
+} tDCPART;
+
+/* pipe read through decomp_fopen() */
+typedef struct
+{
+  int fmt;
+  tDEC d;
+  FILE *fp;
+  const char *fn;
+  char *in;			/* input buffer */
+  size_t inlen, ip;		/* bytes in it, bytes decoded */
+  int eof;
+} tDCFILE;
+
+/*
+	format of data starting with p[0..n-1]: gzip with deflate, xz, a
+	zstd frame or a skippable frame as written first by pzstd
+*/
+int
+decomp_detect (const unsigned char *p, size_t n)
+{
+  if (n >= 4 && p[0] == 0x1f && p[1] == 0x8b && p[2] == 8 && (p[3] & 0xe0) == 0)
+    return DC_GZIP;
+  if (n >= 6 && memcmp (p, "\xfd" "7zXZ\0", 6) == 0)
+    return DC_XZ;
+  if (n >= 4 && ((p[0] == 0x28 && p[1] == 0xb5 && p[2] == 0x2f && p[3] == 0xfd)
+		 || ((p[0] & 0xf0) == 0x50 && p[1] == 0x2a && p[2] == 0x4d
+		     && p[3] == 0x18)))
+    return DC_ZSTD;
+  return DC_NONE;
+}
+
+static void
+unsupported (int fmt, const char *fn)
+{
+  char s[2 * FNLEN];
+
+  snprintf (s, sizeof (s), "%s is %s compressed, build with 'make COMPRESS=%s' to read it",
+	    fn, dcnames[fmt], dcnames[fmt]);
+  gerror (s);
+}
+
+static void
+dec_init (tDEC * d, int fmt, int nthreads, const char *fn)
+{
+  memset (d, 0, sizeof (tDEC));
+  d->fmt = fmt;
+  switch (fmt)
+    {
+#ifdef HAVE_ZLIB
+    case DC_GZIP:
+      if (inflateInit2 (&d->z, 16 + MAX_WBITS) != Z_OK)
+	gerror ("Cannot initialize zlib");
+      return;
+#endif
+#ifdef HAVE_LZMA
+    case DC_XZ:
+      {
+#if LZMA_VERSION >= 50040002
+	lzma_mt mt;
+
+	memset (&mt, 0, sizeof (mt));
+	mt.flags = LZMA_CONCATENATED;
+	mt.threads = nthreads;
+	mt.memlimit_threading = lzma_physmem () / 4;
+	mt.memlimit_stop = UINT64_MAX;
+	if (lzma_stream_decoder_mt (&d->x, &mt) != LZMA_OK)
+	  gerror ("Cannot initialize liblzma");
+#else
+	(void) nthreads;
+	if (lzma_stream_decoder (&d->x, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK)
+	  gerror ("Cannot initialize liblzma");
+#endif
+      }
+      return;
+#endif
+#ifdef HAVE_ZSTD
+    case DC_ZSTD:
+      d->zs = ZSTD_createDStream ();
+      if (d->zs == NULL)
+	gerror ("Cannot initialize libzstd");
+      ZSTD_initDStream (d->zs);
+      return;
+#endif
+    default:
+      (void) nthreads;
+      unsupported (fmt, fn);
+    }
+}
+
+static void
+dec_end (tDEC * d)
+{
+  switch (d->fmt)
+    {
+#ifdef HAVE_ZLIB
+    case DC_GZIP:
+      inflateEnd (&d->z);
+      break;
+#endif
+#ifdef HAVE_LZMA
+    case DC_XZ:
+      lzma_end (&d->x);
+      break;
+#endif
+#ifdef HAVE_ZSTD
+    case DC_ZSTD:
+      ZSTD_freeDStream (d->zs);
+      break;
+#endif
+    }
+}
+
+/*
+	decodes in[*ip..inlen-1] into out[*op..cap-1], last is 1 if no more
+	input follows; returns 1 if it used input or wrote output
+*/
+static int
+dec_step (tDEC * d, const char *in, size_t inlen, size_t * ip, char *out,
+	  size_t cap, size_t * op, int last, const char *fn)
+{
+  size_t i0 = *ip, o0 = *op;
+
+  /* not all of them are used by every format */
+  (void) in;
+  (void) inlen;
+  (void) out;
+  (void) cap;
+  (void) last;
+  (void) fn;
+  switch (d->fmt)
+    {
+#ifdef HAVE_ZLIB
+    case DC_GZIP:
+      {
+	int r;
+
+	/* next member */
+	if (d->done && *ip < inlen)
+	  {
+	    inflateReset (&d->z);
+	    d->done = 0;
+	  }
+	d->z.next_in = (Bytef *) (in + *ip);
+	d->z.avail_in = (uInt) ((inlen - *ip < DCSTEP) ? inlen - *ip : DCSTEP);
+	d->z.next_out = (Bytef *) (out + *op);
+	d->z.avail_out = (uInt) ((cap - *op < DCSTEP) ? cap - *op : DCSTEP);
+	r = inflate (&d->z, Z_NO_FLUSH);
+	*ip = (const char *) d->z.next_in - in;
+	*op = (char *) d->z.next_out - out;
+	if (r == Z_STREAM_END)
+	  d->done = 1;
+	else if (r != Z_OK && r != Z_BUF_ERROR)
+	  gerror1 ("Damaged gzip data in %s", fn);
+      }
+      break;
+#endif
+#ifdef HAVE_LZMA
+    case DC_XZ:
+      {
+	lzma_ret r;
+
+	d->x.next_in = (const uint8_t *) (in + *ip);
+	d->x.avail_in = inlen - *ip;
+	d->x.next_out = (uint8_t *) (out + *op);
+	d->x.avail_out = cap - *op;
+	r = lzma_code (&d->x, last ? LZMA_FINISH : LZMA_RUN);
+	*ip = (const char *) d->x.next_in - in;
+	*op = (char *) d->x.next_out - out;
+	if (r == LZMA_STREAM_END)
+	  d->done = 1;
+	else if (r != LZMA_OK && r != LZMA_BUF_ERROR)
+	  gerror1 ("Damaged xz data in %s", fn);
+      }
+      break;
+#endif
+#ifdef HAVE_ZSTD
+    case DC_ZSTD:
+      {
+	ZSTD_inBuffer ib;
+	ZSTD_outBuffer ob;
+	size_t r;
+
+	ib.src = in;
+	ib.size = inlen;
+	ib.pos = *ip;
+	ob.dst = out;
+	ob.size = cap;
+	ob.pos = *op;
+	r = ZSTD_decompressStream (d->zs, &ob, &ib);
+	if (ZSTD_isError (r))
+	  gerror1 ("Damaged zstd data in %s", fn);
+	*ip = ib.pos;
+	*op = ob.pos;
+	/* 0 after a frame has been decoded and flushed */
+	if (*ip != i0 || *op != o0)
+	  d->done = (r == 0);
+      }
+      break;
+#endif
+    }
+  return (*ip != i0 || *op != o0);
+}
+
+/* decompresses in[0..len-1] on one thread into a buffer that grows by doubling */
+static char *
+decode_serial (int fmt, const char *in, size_t len, int nthreads,
+	       size_t * outlen, const char *fn)
+{
+  tDEC d;
+  size_t ip = 0, op = 0, cap = 4 * len + DCBUF;
+  char *out;
+
+  dec_init (&d, fmt, nthreads, fn);
+  out = (char *) xmalloc (cap);
+  for (;;)
+    {
+      if (op == cap)
+	{
+	  cap *= 2;
+	  out = (char *) xrealloc (out, cap);
+	}
+      if (!dec_step (&d, in, len, &ip, out, cap, &op, 1, fn))
+	break;
+    }
+  dec_end (&d);
+  if (!d.done || ip < len)
+    gerror1 ("Truncated compressed data in %s", fn);
+  *outlen = op;
+  return ((char *) xrealloc (out, op > 0 ? op : 1));
+}
+
+/* decompresses part t, called by the workers */
+static void
+part_task (int t, void *arg)
+{
+  tDCPART *p = (tDCPART *) arg + t;
+  size_t ip = 0, op = 0;
+  tDEC d;
+
+  /* into a buffer of its own */
+  if (p->outlen == DCUNKNOWN)
+    {
+      p->out = decode_serial (p->fmt, p->in, p->inlen, 1, &p->outlen, p->fn);
+      return;
+    }
+  switch (p->fmt)
+    {
+#ifdef HAVE_ZSTD
+    case DC_ZSTD:
+      op = ZSTD_decompress (p->out, p->outlen, p->in, p->inlen);
+      p->bad = (ZSTD_isError (op) || op != p->outlen);
+      return;
+#endif
+    default:
+      dec_init (&d, p->fmt, 1, p->fn);
+      while (dec_step (&d, p->in, p->inlen, &ip, p->out, p->outlen, &op, 1,
+		       p->fn));
+      dec_end (&d);
+      p->bad = (!d.done || ip != p->inlen || op != p->outlen);
+    }
+}
+
+#if defined (HAVE_ZLIB) || defined (HAVE_ZSTD)
+/* appends the part in[start..end-1] with outlen bytes of output */
+static void
+add_part (tDCPART ** pt, int *n, const char *in, size_t start, size_t end,
+	  size_t outlen)
+{
+  if ((*n & 63) == 0)
+    *pt = (tDCPART *) xrealloc (*pt, (*n + 64) * sizeof (tDCPART));
+  (*pt)[*n].in = in + start;
+  (*pt)[*n].inlen = end - start;
+  (*pt)[*n].outlen = outlen;
+  (*n)++;
+}
+#endif
+
+#ifdef HAVE_ZLIB
+/*
+	splits a BGZF file into parts of whole members of at least DCPART
+	bytes; returns their number, 0 if it is no BGZF file
+*/
+static int
+split_bgzf (const char *in, size_t len, tDCPART ** pt)
+{
+  const unsigned char *p;
+  size_t pos, start, olen, xlen, k, m;
+  int n = 0;
+
+  for (pos = start = olen = 0; pos < len; pos += m)
+    {
+      p = (const unsigned char *) in + pos;
+      if (len - pos < 18 || p[0] != 0x1f || p[1] != 0x8b || p[2] != 8
+	  || !(p[3] & 4))
+	break;
+      /* subfield BC holds the length of the member - 1 */
+      xlen = p[10] | (size_t) p[11] << 8;
+      for (k = 12, m = 0; k + 4 <= 12 + xlen && pos + k + 6 <= len;
+	   k += 4 + (p[k + 2] | (size_t) p[k + 3] << 8))
+	if (p[k] == 'B' && p[k + 1] == 'C' && p[k + 2] == 2 && p[k + 3] == 0)
+	  m = (p[k + 4] | (size_t) p[k + 5] << 8) + 1;
+      if (m < 18 || m > len - pos)
+	break;
+      /* the trailer holds the uncompressed length */
+      olen += p[m - 4] | (size_t) p[m - 3] << 8 | (size_t) p[m - 2] << 16
+	| (size_t) p[m - 1] << 24;
+      if (pos + m - start >= DCPART || pos + m == len)
+	{
+	  add_part (pt, &n, in, start, pos + m, olen);
+	  start = pos + m;
+	  olen = 0;
+	}
+    }
+  return (pos == len ? n : 0);
+}
+#endif
+
+#ifdef HAVE_ZSTD
+/*
+	splits a zstd file into parts of whole frames of at least DCPART
+	bytes; returns their number
+*/
+static int
+split_zstd (const char *in, size_t len, tDCPART ** pt)
+{
+  size_t pos, start, olen, m;
+  unsigned long long c;
+  int n = 0;
+
+  for (pos = start = olen = 0; pos < len; pos += m)
+    {
+      m = ZSTD_findFrameCompressedSize (in + pos, len - pos);
+      if (ZSTD_isError (m))
+	return (0);
+      c = ZSTD_getFrameContentSize (in + pos, m);
+      if (c == ZSTD_CONTENTSIZE_UNKNOWN || c == ZSTD_CONTENTSIZE_ERROR
+	  || olen == DCUNKNOWN)
+	olen = DCUNKNOWN;
+      else
+	olen += c;
+      if (pos + m - start >= DCPART || pos + m == len)
+	{
+	  add_part (pt, &n, in, start, pos + m, olen);
+	  start = pos + m;
+	  olen = 0;
+	}
+    }
+  return (n);
+}
+#endif
+
+/*
+	decompresses the file fn in in[0..len-1], of format fmt, into a new
+	buffer of *outlen bytes; on nthreads threads if it can be split
+	parts whose output length is not recorded are decompressed into
+	buffers of their own, which are joined afterwards
+*/
+char *
+decomp_buffer (int fmt, const char *in, size_t len, int nthreads,
+	       size_t * outlen, const char *fn)
+{
+  tDCPART *pt = NULL;
+  double *cost;
+  char *out;
+  size_t o;
+  int n = 0, i, known;
+
+#ifdef HAVE_ZLIB
+  if (fmt == DC_GZIP && nthreads > 1)
+    n = split_bgzf (in, len, &pt);
+#endif
+#ifdef HAVE_ZSTD
+  if (fmt == DC_ZSTD && nthreads > 1)
+    n = split_zstd (in, len, &pt);
+#endif
+  if (n < 2)
+    {
+      xfree (pt);
+      return (decode_serial (fmt, in, len, nthreads, outlen, fn));
+    }
+
+  for (i = 0, o = 0, known = 1; i < n; i++)
+    if (pt[i].outlen == DCUNKNOWN)
+      known = 0;
+    else
+      o += pt[i].outlen;
+  out = known ? (char *) xmalloc (o > 0 ? o : 1) : NULL;
+  cost = (double *) xmalloc (n * sizeof (double));
+  for (i = 0, o = 0; i < n; i++)
+    {
+      pt[i].fmt = fmt;
+      pt[i].fn = fn;
+      pt[i].bad = 0;
+      if (known)
+	{
+	  pt[i].out = out + o;
+	  o += pt[i].outlen;
+	}
+      else
+	pt[i].outlen = DCUNKNOWN;
+      cost[i] = (double) pt[i].inlen;
+    }
+  run_tasks (n, cost, nthreads, part_task, pt, NULL);
+  for (i = 0; i < n; i++)
+    if (pt[i].bad)
+      gerror1 ("Damaged compressed data in %s", fn);
+  if (!known)
+    {
+      for (i = 0, o = 0; i < n; i++)
+	o += pt[i].outlen;
+      out = (char *) xmalloc (o > 0 ? o : 1);
+      for (i = 0, o = 0; i < n; i++)
+	{
+	  memcpy (out + o, pt[i].out, pt[i].outlen);
+	  o += pt[i].outlen;
+	  xfree (pt[i].out);
+	}
+    }
+  xfree (cost);
+  xfree (pt);
+  *outlen = o;
+  return (out);
+}
+
+static ssize_t
+dc_read (void *cookie, char *buf, size_t size)
+{
+  tDCFILE *f = (tDCFILE *) cookie;
+  size_t op = 0;
+
+  /* uncompressed: the bytes taken by decomp_detect(), then the pipe */
+  if (f->fmt == DC_NONE)
+    {
+      if (f->ip == f->inlen)
+	return ((ssize_t) fread (buf, 1, size, f->fp));
+      op = (size < f->inlen - f->ip) ? size : f->inlen - f->ip;
+      memcpy (buf, f->in + f->ip, op);
+      f->ip += op;
+      return ((ssize_t) op);
+    }
+
+  while (op == 0)
+    {
+      if (f->ip == f->inlen && !f->eof)
+	{
+	  f->inlen = fread (f->in, 1, DCBUF, f->fp);
+	  f->ip = 0;
+	  f->eof = (f->inlen == 0);
+	}
+      if (!dec_step (&f->d, f->in, f->inlen, &f->ip, buf, size, &op, f->eof,
+		     f->fn))
+	{
+	  if (!f->eof)
+	    gerror1 ("Damaged compressed data in %s", f->fn);
+	  if (!f->d.done)
+	    gerror1 ("Truncated compressed data in %s", f->fn);
+	  break;
+	}
+    }
+  return ((ssize_t) op);
+}
+
+static int
+dc_close (void *cookie)
+{
+  tDCFILE *f = (tDCFILE *) cookie;
+
+  if (f->fmt != DC_NONE)
+    dec_end (&f->d);
+  if (f->fp != stdin)
+    fclose (f->fp);
+  xfree (f->in);
+  xfree (f);
+  return (0);
+}
+
+/*
+	returns a stream of the decompressed data of fp, which is in format
+	fmt; head[0..nhead-1] are the bytes already read from fp
+	closing the stream closes fp, unless it is stdin
+*/
+FILE *
+decomp_fopen (int fmt, FILE * fp, const unsigned char *head, size_t nhead,
+	      const char *fn)
+{
+  cookie_io_functions_t io = { dc_read, NULL, NULL, dc_close };
+  tDCFILE *f;
+
+  f = (tDCFILE *) xmalloc (sizeof (tDCFILE));
+  memset (f, 0, sizeof (tDCFILE));
+  f->fmt = fmt;
+  f->fp = fp;
+  f->fn = fn;
+  f->in = (char *) xmalloc (DCBUF);
+  memcpy (f->in, head, nhead);
+  f->inlen = nhead;
+  if (fmt != DC_NONE)
+    dec_init (&f->d, fmt, 1, fn);
+  return (fopencookie (f, "r", io));
+}
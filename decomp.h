@@ -0,0 +1,20 @@
+#ifndef __decomp_h
+#define __decomp_h
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define DC_NONE 0		/* not compressed */
+#define DC_GZIP 1
+#define DC_XZ 2
+#define DC_ZSTD 3
+
+#define DCMAGIC 6		/* bytes decomp_detect() looks at */
+
+int decomp_detect (const unsigned char *p, size_t n);
+char *decomp_buffer (int fmt, const char *in, size_t len, int nthreads,
+		     size_t * outlen, const char *fn);
+FILE *decomp_fopen (int fmt, FILE * fp, const unsigned char *head,
+		    size_t nhead, const char *fn);
+
+#endif
@@ -0,0 +1,259 @@
+/********************************************************************************
+    detrend.c
+
+    linear regression of data segments in O(1) per segment
+
+    detrend_index() is called once after the data have been read. It stores
+    compensated (double-double) prefix sums of x[j] and j*x[j] at every
+    DTSTEP-th sample. The sums over a segment [start, start+nfft) are then
+    the difference of two prefix sums, each completed by at most DTSTEP-1
+    samples after its checkpoint, so that the cost of detrend_coeffs() does
+    not depend on nfft and the index takes 4/DTSTEP doubles per sample.
+    The double-double arithmetic keeps the differences accurate to about
+    1e-16 relative to the segment sums even far into long time series.
+
+    A compact series keeps the samples of the input (int16, int32 or
+    float32) with the scaling factor ulsb and the mean to be subtracted.
+    The index, detrend_coeffs() and the DFT kernels work on the raw
+    samples; the kernels multiply their results by ulsb. For a series of
+    doubles ulsb is 1 and the mean 0.
+ ********************************************************************************/
+#include <stdlib.h>
+#include <math.h>
+#include "misc.h"
+#include "errors.h"
+#include "detrend.h"
+
+/* p = a * b exactly */
+static tDD
+two_prod (double a, double b)
+{
+  tDD p;
+
+  p.hi = a * b;
+#ifdef FP_FAST_FMA
+  p.lo = fma (a, b, -p.hi);
+#else
+  {
+    const double split = 134217729.0;	/* 2^27 + 1 */
+    double t, ah, al, bh, bl;
+
+    t = split * a;
+    ah = t - (t - a);
+    al = a - ah;
+    t = split * b;
+    bh = t - (t - b);
+    bl = b - bh;
+    p.lo = ((ah * bh - p.hi) + ah * bl + al * bh) + al * bl;
+  }
+#endif
+  return p;
+}
+
+static tDD
+dd_add (tDD a, tDD b)
+{
+  tDD s = two_sum (a.hi, b.hi);
+
+  s.lo += a.lo + b.lo;
+  return two_sum (s.hi, s.lo);
+}
+
+static tDD
+dd_neg (tDD a)
+{
+  a.hi = -a.hi;
+  a.lo = -a.lo;
+  return a;
+}
+
+/* a * b for a double-double a and a double b */
+static tDD
+dd_mul_d (tDD a, double b)
+{
+  tDD p = two_prod (a.hi, b);
+
+  p.lo += a.lo * b;
+  return two_sum (p.hi, p.lo);
+}
+
+/*
+	builds the detrend index for the n samples in raw of the given type,
+	whose values are (raw[j] - mean) * ulsb
+	the prefix sums are only needed for linear regression (LR == 1)
+*/
+tDTIDX *
+detrend_index_raw (const void *raw, int type, double ulsb, double mean,
+		   long long n, int LR)
+{
+  tDTIDX *dt;
+  tDD s, u;
+  double v;
+  long long j, c;
+
+  dt = (tDTIDX *) xmalloc (sizeof (tDTIDX));
+  dt->x = (type == SMP_F64) ? (const double *) raw : NULL;
+  dt->raw = raw;
+  dt->type = type;
+  dt->ulsb = ulsb;
+  dt->mean = mean;
+  dt->n = n;
+  dt->s = dt->u = NULL;
+  if (LR != 1)
+    return dt;
+
+  dt->s = (tDD *) xmalloc ((n / DTSTEP + 1) * sizeof (tDD));
+  dt->u = (tDD *) xmalloc ((n / DTSTEP + 1) * sizeof (tDD));
+  s.hi = s.lo = u.hi = u.lo = 0;
+  for (j = 0, c = 0; j < n; j++)
+    {
+      if (j % DTSTEP == 0)
+	{
+	  dt->s[c] = s;
+	  dt->u[c++] = u;
+	}
+      v = smp_value (dt, j);
+      s = dd_add (s, two_sum (v, 0.));
+      u = dd_add (u, two_prod ((double) j, v));
+    }
+  if (n % DTSTEP == 0)
+    {
+      dt->s[c] = s;
+      dt->u[c] = u;
+    }
+  return dt;
+}
+
+/* detrend index for the n doubles in x */
+tDTIDX *
+detrend_index (const double *x, long long n, int LR)
+{
+  return detrend_index_raw (x, SMP_F64, 1.0, 0.0, n, LR);
+}
+
+/*
+	raw samples start..start+n-1 as doubles: in place for a series of
+	doubles, otherwise converted into buf
+*/
+const double *
+smp_block (const tDTIDX * dt, long long start, long long n, double *buf)
+{
+  long long j;
+
+  if (dt->x != NULL)
+    return dt->x + start;
+  for (j = 0; j < n; j++)
+    buf[j] = smp_value (dt, start + j);
+  return buf;
+}
+
+void
+detrend_free (tDTIDX * dt)
+{
+  if (dt == NULL)
+    return;
+  if (dt->s)
+    xfree (dt->s);
+  if (dt->u)
+    xfree (dt->u);
+  xfree (dt);
+}
+
+/* sums of x[j] and j*x[j] for j < k */
+static void
+prefix (const tDTIDX * dt, long long k, tDD * s, tDD * u)
+{
+  long long j = (k / DTSTEP) * DTSTEP;
+  double v;
+
+  *s = dt->s[k / DTSTEP];
+  *u = dt->u[k / DTSTEP];
+  for (; j < k; j++)
+    {
+      v = smp_value (dt, j);
+      *s = dd_add (*s, two_sum (v, 0.));
+      *u = dd_add (*u, two_prod ((double) j, v));
+    }
+}
+
+/*
+	returns the straight line a + b*i, i = 0..nfft-1, to be subtracted 
+	from the raw segment x[start..start+nfft-1]; it includes the mean of
+	a compact series
+
+	LR	0 no detrending: a = mean, b = 0
+		1 linear regression
+		2 line through first and last point
+*/
+void
+detrend_coeffs (const tDTIDX * dt, long long start, long long nfft,
+		int LR, double *a, double *b)
+{
+  tDD s0, u0, s1, u1, sy, sty;
+  double ndbl, xm, stt;
+
+  if (LR == 2)  { /* subtract straight line through first and last point */
+    *a = smp_value (dt, start) - dt->mean;
+    *b = smp_value (dt, start + nfft - 1) - dt->mean - *a / (double) (nfft - 1.0);
+    *a += dt->mean;
+  }
+
+  else if (LR == 1) { /* linear regression */
+    if (dt->s == NULL)
+      gerror ("detrend index was built without linear regression");
+    ndbl = (double) nfft;
+    xm = (ndbl - 1.0) / 2.0;
+    stt = (ndbl * ndbl - 1.0) * ndbl / 12.0;
+
+    prefix (dt, start, &s0, &u0);
+    prefix (dt, start + nfft, &s1, &u1);
+    sy = dd_add (s1, dd_neg (s0));
+    /* sum of (j - start - xm) * x[j], start + xm is exact */
+    sty = dd_add (dd_add (u1, dd_neg (u0)), dd_neg (dd_mul_d (sy, start + xm)));
+
+    *b = (sty.hi + sty.lo) / stt;
+    *a = (sy.hi + sy.lo) / ndbl - xm * *b;
+  }
+
+  else {  /* no detrending */
+    *a = dt->mean;
+    *b = 0.0;
+  }
+}
+
+/*
+	adds the sums of x[j] and (j-start+shift)*x[j], j = start..start+n-1,
+	to *sy and *sty, for segments that are summed up part by part;
+	shift is the index of x[start] within its segment
+*/
+void
+detrend_accum (const tDTIDX * dt, long long start, long long n,
+	       double shift, tDD * sy, tDD * sty)
+{
+  tDD s0, u0, s1, u1, s;
+
+  if (dt->s == NULL)
+    gerror ("detrend index was built without linear regression");
+  prefix (dt, start, &s0, &u0);
+  prefix (dt, start + n, &s1, &u1);
+  s = dd_add (s1, dd_neg (s0));
+  *sy = dd_add (*sy, s);
+  *sty = dd_add (*sty, dd_add (dd_add (u1, dd_neg (u0)),
+			      dd_mul_d (s, shift - start)));
+}
+
+/*
+	straight line a + b*i of the linear regression of a segment of nfft
+	samples from the sums sy of its x[i] and sty of its i*x[i]
+*/
+void
+detrend_fit (tDD sy, tDD sty, long long nfft, double *a, double *b)
+{
+  double ndbl = (double) nfft;
+  double xm = (ndbl - 1.0) / 2.0;
+  double stt = (ndbl * ndbl - 1.0) * ndbl / 12.0;
+
+  sty = dd_add (sty, dd_neg (dd_mul_d (sy, xm)));
+  *b = (sty.hi + sty.lo) / stt;
+  *a = (sy.hi + sy.lo) / ndbl - xm * *b;
+}
@@ -0,0 +1,91 @@
+#ifndef __detrend_h
+#define __detrend_h
+
+#include <stdint.h>
+
+#define DTSTEP 16		/* distance between checkpoints of the detrend index */
+
+typedef struct
+{
+  double hi, lo;		/* value is hi + lo, |lo| <= ulp(hi)/2 */
+} tDD;
+
+/* s = a + b exactly */
+static inline tDD
+two_sum (double a, double b)
+{
+  tDD s;
+  double bb;
+
+  s.hi = a + b;
+  bb = s.hi - a;
+  s.lo = (a - (s.hi - bb)) + (b - bb);
+  return s;
+}
+
+/* adds the double b to the double-double a */
+static inline void
+dd_add_d (tDD * a, double b)
+{
+  tDD s = two_sum (a->hi, b);
+
+  s.lo += a->lo;
+  *a = two_sum (s.hi, s.lo);
+}
+
+/* returns a - b rounded to double */
+static inline double
+dd_diff (tDD a, tDD b)
+{
+  tDD d = two_sum (a.hi, -b.hi);
+
+  return d.hi + (d.lo + (a.lo - b.lo));
+}
+
+/* types of the samples of a time series */
+#define SMP_F64 0		/* double */
+#define SMP_F32 1		/* float */
+#define SMP_I32 2		/* int32_t */
+#define SMP_I16 3		/* int16_t */
+
+typedef struct
+{
+  const double *x;		/* time series the index was built for, NULL if compact */
+  const void *raw;		/* its samples, of type type */
+  int type;			/* SMP_F64 if x is set */
+  double ulsb, mean;		/* value j of the series is (raw[j] - mean) * ulsb */
+  long long n;			/* number of samples */
+  tDD *s;			/* s[c] = sum of x[j] for j < c*DTSTEP */
+  tDD *u;			/* u[c] = sum of j*x[j] for j < c*DTSTEP */
+} tDTIDX;
+
+/* sample j of the series before scaling and mean subtraction */
+static inline double
+smp_value (const tDTIDX * dt, long long j)
+{
+  switch (dt->type)
+    {
+    case SMP_F32:
+      return ((const float *) dt->raw)[j];
+    case SMP_I32:
+      return ((const int32_t *) dt->raw)[j];
+    case SMP_I16:
+      return ((const int16_t *) dt->raw)[j];
+    default:
+      return dt->x[j];
+    }
+}
+
+tDTIDX *detrend_index (const double *x, long long n, int LR);
+tDTIDX *detrend_index_raw (const void *raw, int type, double ulsb,
+			   double mean, long long n, int LR);
+const double *smp_block (const tDTIDX * dt, long long start, long long n,
+			 double *buf);
+void detrend_free (tDTIDX * dt);
+void detrend_coeffs (const tDTIDX * dt, long long start, long long nfft,
+		     int LR, double *a, double *b);
+void detrend_accum (const tDTIDX * dt, long long start, long long n,
+		    double shift, tDD * sy, tDD * sty);
+void detrend_fit (tDD sy, tDD sty, long long nfft, double *a, double *b);
+
+#endif
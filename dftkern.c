@@ -0,0 +1,233 @@
+/********************************************************************************
+    dftkern.c
+
+    inner loop of getDFT2(): DFT of one windowed data segment
+
+	re = sum_i x[i] * wcos[i]
+	im = sum_i x[i] * wsin[i]
+
+    The kernel does not detrend. Since the DFT is linear, the DFT of the
+    detrended segment x[i] - (a + b*i) is re + i*im - a*W0 - b*W1, with the
+    window constants W0, W1 returned by makewinsincos(). getDFT2() applies
+    this correction once per segment instead of once per sample.
+
+    The kernel is selected at compile time (see SIMD in the Makefile):
+	AVX-512F	if __AVX512F__ is defined
+	AVX2 + FMA	if __AVX2__ and __FMA__ are defined
+	scalar		otherwise, or if DFT_SCALAR is defined
+    All kernels keep several independent accumulators and are unrolled.
+    wcos and wsin should be aligned to DFT_ALIGN bytes for speed, but any
+    of the arrays may be unaligned (the sliding DFT of sdft.c passes
+    pointers into the middle of its tables).
+
+    The samples x may also be float, int32_t or int16_t, as kept by a
+    compact series (detrend.c): dft_dot_f32(), dft_dot_i32() and
+    dft_dot_i16() widen them to double in registers, so that the data
+    stream through memory at 4 or 2 bytes per sample. dft_dot_smp()
+    selects the kernel by the type of the series. All kernels of one
+    instruction set share the loop of DFT_DOT() and differ only in the
+    load of the samples.
+
+    Accuracy: the kernels only differ from the serial loop of getDFT()
+    in the order of summation (and in fused multiply-adds). Against the
+    serial loop, the PSD and PS of a bin agree to a relative difference of
+    less than 1e-10 for nfft up to 1e7 in our tests (typically 1e-14); this
+    is far below the statistical error of any spectral estimate. Taking
+    the trend out after the sum costs precision only if the trend of a
+    segment is many orders of magnitude larger than the noise in it.
+ ********************************************************************************/
+#include "dftkern.h"
+
+#if defined(__AVX512F__) && !defined(DFT_SCALAR)
+
+#include <immintrin.h>
+
+const char *
+dft_kernel_name (void)
+{
+  return "AVX-512";
+}
+
+/* 8 samples at p as doubles */
+#define LOAD_F64(p) _mm512_loadu_pd (p)
+#define LOAD_F32(p) _mm512_cvtps_pd (_mm256_loadu_ps (p))
+#define LOAD_I32(p) _mm512_cvtepi32_pd (_mm256_loadu_si256 ((const __m256i *) (p)))
+#define LOAD_I16(p) _mm512_cvtepi32_pd (_mm256_cvtepi16_epi32 (_mm_loadu_si128 ((const __m128i *) (p))))
+
+#define DFT_DOT(name, T, LOAD)						\
+void									\
+name (const T *x, const double *wcos, const double *wsin,		\
+      long long n, double *re, double *im)				\
+{									\
+  __m512d r0, r1, r2, r3, i0, i1, i2, i3;				\
+  __m512d y0, y1, y2, y3;						\
+  double sr, si;							\
+  long long i;								\
+									\
+  r0 = r1 = r2 = r3 = i0 = i1 = i2 = i3 = _mm512_setzero_pd ();	\
+  for (i = 0; i + 32 <= n; i += 32)					\
+    {									\
+      y0 = LOAD (x + i);						\
+      y1 = LOAD (x + i + 8);						\
+      y2 = LOAD (x + i + 16);						\
+      y3 = LOAD (x + i + 24);						\
+      r0 = _mm512_fmadd_pd (y0, _mm512_loadu_pd (wcos + i), r0);	\
+      i0 = _mm512_fmadd_pd (y0, _mm512_loadu_pd (wsin + i), i0);	\
+      r1 = _mm512_fmadd_pd (y1, _mm512_loadu_pd (wcos + i + 8), r1);	\
+      i1 = _mm512_fmadd_pd (y1, _mm512_loadu_pd (wsin + i + 8), i1);	\
+      r2 = _mm512_fmadd_pd (y2, _mm512_loadu_pd (wcos + i + 16), r2);	\
+      i2 = _mm512_fmadd_pd (y2, _mm512_loadu_pd (wsin + i + 16), i2);	\
+      r3 = _mm512_fmadd_pd (y3, _mm512_loadu_pd (wcos + i + 24), r3);	\
+      i3 = _mm512_fmadd_pd (y3, _mm512_loadu_pd (wsin + i + 24), i3);	\
+    }									\
+  for (; i + 8 <= n; i += 8)						\
+    {									\
+      y0 = LOAD (x + i);						\
+      r0 = _mm512_fmadd_pd (y0, _mm512_loadu_pd (wcos + i), r0);	\
+      i0 = _mm512_fmadd_pd (y0, _mm512_loadu_pd (wsin + i), i0);	\
+    }									\
+  r0 = _mm512_add_pd (_mm512_add_pd (r0, r1), _mm512_add_pd (r2, r3));	\
+  i0 = _mm512_add_pd (_mm512_add_pd (i0, i1), _mm512_add_pd (i2, i3));	\
+  sr = _mm512_reduce_add_pd (r0);					\
+  si = _mm512_reduce_add_pd (i0);					\
+  for (; i < n; i++)							\
+    {									\
+      sr += wcos[i] * x[i];						\
+      si += wsin[i] * x[i];						\
+    }									\
+  *re = sr;								\
+  *im = si;								\
+}
+
+#elif defined(__AVX2__) && defined(__FMA__) && !defined(DFT_SCALAR)
+
+#include <immintrin.h>
+
+const char *
+dft_kernel_name (void)
+{
+  return "AVX2";
+}
+
+static double
+hsum256 (__m256d v)
+{
+  __m128d lo = _mm256_castpd256_pd128 (v);
+  __m128d hi = _mm256_extractf128_pd (v, 1);
+  lo = _mm_add_pd (lo, hi);
+  return _mm_cvtsd_f64 (_mm_add_sd (lo, _mm_unpackhi_pd (lo, lo)));
+}
+
+/* 4 samples at p as doubles */
+#define LOAD_F64(p) _mm256_loadu_pd (p)
+#define LOAD_F32(p) _mm256_cvtps_pd (_mm_loadu_ps (p))
+#define LOAD_I32(p) _mm256_cvtepi32_pd (_mm_loadu_si128 ((const __m128i *) (p)))
+#define LOAD_I16(p) _mm256_cvtepi32_pd (_mm_cvtepi16_epi32 (_mm_loadl_epi64 ((const __m128i *) (p))))
+
+#define DFT_DOT(name, T, LOAD)						\
+void									\
+name (const T *x, const double *wcos, const double *wsin,		\
+      long long n, double *re, double *im)				\
+{									\
+  __m256d r0, r1, r2, r3, i0, i1, i2, i3;				\
+  __m256d y0, y1, y2, y3;						\
+  double sr, si;							\
+  long long i;								\
+									\
+  r0 = r1 = r2 = r3 = i0 = i1 = i2 = i3 = _mm256_setzero_pd ();	\
+  for (i = 0; i + 16 <= n; i += 16)					\
+    {									\
+      y0 = LOAD (x + i);						\
+      y1 = LOAD (x + i + 4);						\
+      y2 = LOAD (x + i + 8);						\
+      y3 = LOAD (x + i + 12);						\
+      r0 = _mm256_fmadd_pd (y0, _mm256_loadu_pd (wcos + i), r0);	\
+      i0 = _mm256_fmadd_pd (y0, _mm256_loadu_pd (wsin + i), i0);	\
+      r1 = _mm256_fmadd_pd (y1, _mm256_loadu_pd (wcos + i + 4), r1);	\
+      i1 = _mm256_fmadd_pd (y1, _mm256_loadu_pd (wsin + i + 4), i1);	\
+      r2 = _mm256_fmadd_pd (y2, _mm256_loadu_pd (wcos + i + 8), r2);	\
+      i2 = _mm256_fmadd_pd (y2, _mm256_loadu_pd (wsin + i + 8), i2);	\
+      r3 = _mm256_fmadd_pd (y3, _mm256_loadu_pd (wcos + i + 12), r3);	\
+      i3 = _mm256_fmadd_pd (y3, _mm256_loadu_pd (wsin + i + 12), i3);	\
+    }									\
+  for (; i + 4 <= n; i += 4)						\
+    {									\
+      y0 = LOAD (x + i);						\
+      r0 = _mm256_fmadd_pd (y0, _mm256_loadu_pd (wcos + i), r0);	\
+      i0 = _mm256_fmadd_pd (y0, _mm256_loadu_pd (wsin + i), i0);	\
+    }									\
+  sr = hsum256 (_mm256_add_pd (_mm256_add_pd (r0, r1), _mm256_add_pd (r2, r3)));	\
+  si = hsum256 (_mm256_add_pd (_mm256_add_pd (i0, i1), _mm256_add_pd (i2, i3)));	\
+  for (; i < n; i++)							\
+    {									\
+      sr += wcos[i] * x[i];						\
+      si += wsin[i] * x[i];						\
+    }									\
+  *re = sr;								\
+  *im = si;								\
+}
+
+#else
+
+const char *
+dft_kernel_name (void)
+{
+  return "scalar";
+}
+
+#define DFT_DOT(name, T, LOAD)						\
+void									\
+name (const T *x, const double *wcos, const double *wsin,		\
+      long long n, double *re, double *im)				\
+{									\
+  double r0 = 0, r1 = 0, r2 = 0, r3 = 0;				\
+  double i0 = 0, i1 = 0, i2 = 0, i3 = 0;				\
+  long long i;								\
+									\
+  for (i = 0; i + 4 <= n; i += 4)					\
+    {									\
+      r0 += wcos[i] * x[i];						\
+      i0 += wsin[i] * x[i];						\
+      r1 += wcos[i + 1] * x[i + 1];					\
+      i1 += wsin[i + 1] * x[i + 1];					\
+      r2 += wcos[i + 2] * x[i + 2];					\
+      i2 += wsin[i + 2] * x[i + 2];					\
+      r3 += wcos[i + 3] * x[i + 3];					\
+      i3 += wsin[i + 3] * x[i + 3];					\
+    }									\
+  for (; i < n; i++)							\
+    {									\
+      r0 += wcos[i] * x[i];						\
+      i0 += wsin[i] * x[i];						\
+    }									\
+  *re = (r0 + r1) + (r2 + r3);						\
+  *im = (i0 + i1) + (i2 + i3);						\
+}
+
+#endif
+
+DFT_DOT (dft_dot, double, LOAD_F64)
+DFT_DOT (dft_dot_f32, float, LOAD_F32)
+DFT_DOT (dft_dot_i32, int32_t, LOAD_I32)
+DFT_DOT (dft_dot_i16, int16_t, LOAD_I16)
+
+/* kernel for samples start..start+n-1 of the series of dt, in raw units */
+void
+dft_dot_smp (const tDTIDX * dt, long long start, const double *wcos,
+	     const double *wsin, long long n, double *re, double *im)
+{
+  switch (dt->type)
+    {
+    case SMP_F32:
+      dft_dot_f32 ((const float *) dt->raw + start, wcos, wsin, n, re, im);
+      break;
+    case SMP_I32:
+      dft_dot_i32 ((const int32_t *) dt->raw + start, wcos, wsin, n, re, im);
+      break;
+    case SMP_I16:
+      dft_dot_i16 ((const int16_t *) dt->raw + start, wcos, wsin, n, re, im);
+      break;
+    default:
+      dft_dot (dt->x + start, wcos, wsin, n, re, im);
+    }
+}
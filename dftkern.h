@@ -0,0 +1,21 @@
+#ifndef __dftkern_h
+#define __dftkern_h
+
+#include <stdint.h>
+#include "detrend.h"
+
+#define DFT_ALIGN 64		/* alignment of wcos, wsin tables in bytes */
+
+const char *dft_kernel_name (void);
+void dft_dot (const double *x, const double *wcos, const double *wsin,
+	      long long n, double *re, double *im);
+void dft_dot_f32 (const float *x, const double *wcos, const double *wsin,
+		  long long n, double *re, double *im);
+void dft_dot_i32 (const int32_t *x, const double *wcos, const double *wsin,
+		  long long n, double *re, double *im);
+void dft_dot_i16 (const int16_t *x, const double *wcos, const double *wsin,
+		  long long n, double *re, double *im);
+void dft_dot_smp (const tDTIDX * dt, long long start, const double *wcos,
+		  const double *wsin, long long n, double *re, double *im);
+
+#endif
@@ -0,0 +1,335 @@
+/********************************************************************************
+    fftplan.c
+
+    FFTW plans and wisdom shared by all FFT-based paths of lpsd
+
+    Plans are kept in a cache keyed by kind, length, number of transforms
+    and planner flags, and every later request with the same key gets the
+    same plan. Callers run the plans on their own buffers with the
+    new-array functions fftw_execute_dft() and fftw_execute_dft_r2c(); the
+    buffers must come from fftw_malloc() unless the plan was made with
+    FFTW_UNALIGNED. Plans are made on scratch arrays, so FFTW_MEASURE and
+    higher rigors never overwrite the callers' data.
+
+    The planning rigor (estimate, measure, patient, exhaustive) and the
+    wisdom file are set by fftplan_init(). The wisdom file is imported
+    when the first plan is made, so runs without FFTs never touch it. If
+    the plans have added to the wisdom and the rigor is not estimate,
+    fftplan_free() merges the wisdom with the file once more, in case
+    another run has written it in the meantime, and writes it back through
+    a temporary file. The wisdom thus collects every FFT length planned by
+    any run, e.g. all nfft of FFT mode, which round_down() takes from a
+    small set of lengths, and measured plans are found at no cost next time.
+
+    At most FPMAXPLANS plans that are not in use are kept, the least
+    recently used one is destroyed first. The FFTW planner is not
+    thread-safe: planning and destroying plans is serialized by the lock
+    of the cache, executing plans is not.
+ ********************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <fftw3.h>
+#include "config.h"
+#include "misc.h"
+#include "errors.h"
+#include "fftplan.h"
+
+static tFFTPLAN *head = NULL;	/* most recently used plan */
+static tFFTPLAN *tail = NULL;	/* least recently used plan */
+static int nplans = 0;		/* number of plans in the cache */
+static long hits = 0, misses = 0;
+static unsigned rigorflag = FFTW_ESTIMATE;
+static char wisdomfn[FNLEN] = "";
+static int wisdom_read = 0;	/* 1 once the wisdom file has been imported */
+static char *wisdom0 = NULL;	/* wisdom after the import */
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const struct
+{
+  const char *name;
+  unsigned flag;
+} rigors[] = {
+  {"estimate", FFTW_ESTIMATE},
+  {"measure", FFTW_MEASURE},
+  {"patient", FFTW_PATIENT},
+  {"exhaustive", FFTW_EXHAUSTIVE}
+};
+
+static void
+unlink_plan (tFFTPLAN * p)
+{
+  if (p->prev)
+    p->prev->next = p->next;
+  else
+    head = p->next;
+  if (p->next)
+    p->next->prev = p->prev;
+  else
+    tail = p->prev;
+  p->prev = p->next = NULL;
+}
+
+static void
+push_front (tFFTPLAN * p)
+{
+  p->prev = NULL;
+  p->next = head;
+  if (head)
+    head->prev = p;
+  head = p;
+  if (!tail)
+    tail = p;
+}
+
+/* destroys unused plans, least recently used first, down to FPMAXPLANS */
+static void
+evict (void)
+{
+  tFFTPLAN *p, *prev;
+
+  for (p = tail; p && nplans > FPMAXPLANS; p = prev)
+    {
+      prev = p->prev;
+      if (p->refs > 0)
+	continue;
+      unlink_plan (p);
+      fftw_destroy_plan (p->plan);
+      xfree (p);
+      nplans--;
+    }
+}
+
+/*
+	1-dimensional FFTW plans through the guru64 interface, whose lengths
+	are not limited to int like those of fftw_plan_dft_1d()
+*/
+static fftw_plan
+plan_dft_1d (long long n, fftw_complex * in, fftw_complex * out, int sign,
+	     unsigned flags)
+{
+  fftw_iodim64 dim;
+
+  dim.n = n;
+  dim.is = 1;
+  dim.os = 1;
+  return fftw_plan_guru64_dft (1, &dim, 0, NULL, in, out, sign, flags);
+}
+
+/*
+	r2c FFTs of howmany consecutive real arrays of length n into arrays of
+	n/2+1 complex values, one array if howmany is 1
+*/
+static fftw_plan
+plan_r2c_many (long long n, long long howmany, double *in, fftw_complex * out,
+	       unsigned flags)
+{
+  fftw_iodim64 dim, hdim;
+
+  dim.n = n;
+  dim.is = 1;
+  dim.os = 1;
+  hdim.n = howmany;
+  hdim.is = n;
+  hdim.os = n / 2 + 1;
+  return fftw_plan_guru64_dft_r2c (1, &dim, howmany > 1, &hdim, in, out,
+				   flags);
+}
+
+/*
+	imports the wisdom file before the first plan is made, called with
+	the lock held; a missing file is reported once
+*/
+static void
+import_wisdom (void)
+{
+  FILE *wfp;
+
+  wisdom_read = 1;
+  if (wisdomfn[0] == '\0')
+    return;
+  if ((wfp = fopen (wisdomfn, "r")) == NULL)
+    message1 ("Cannot open '%s'", wisdomfn);
+  else
+    {
+      if (fftw_import_wisdom_from_file (wfp) == 0)
+	message ("Error importing wisdom");
+      fclose (wfp);
+    }
+  wisdom0 = fftw_export_wisdom_to_string ();
+}
+
+/* makes a plan on scratch arrays, called with the lock held */
+static fftw_plan
+make_plan (int kind, long long n, long long howmany, unsigned flags)
+{
+  fftw_complex *c;
+  double *r = NULL;
+  fftw_plan plan;
+
+  if (!wisdom_read)
+    import_wisdom ();
+  if (kind == FP_DFT)
+    c = (fftw_complex *) fftw_malloc (n * sizeof (fftw_complex));
+  else
+    {
+      r = (double *) fftw_malloc (howmany * n * sizeof (double));
+      c = (fftw_complex *) fftw_malloc (howmany * (n / 2 + 1)
+					* sizeof (fftw_complex));
+      if (r == NULL)
+	gerror ("Cannot allocate FFT buffers");
+    }
+  if (c == NULL)
+    gerror ("Cannot allocate FFT buffers");
+
+  if (kind == FP_DFT)
+    plan = plan_dft_1d (n, c, c, FFTW_FORWARD, flags | rigorflag);
+  else
+    plan = plan_r2c_many (n, howmany, r, c, flags | rigorflag);
+  if (plan == NULL)
+    gerror ("Cannot plan FFT");
+
+  if (r)
+    fftw_free (r);
+  fftw_free (c);
+  return plan;
+}
+
+/*
+	sets the planning rigor by its name and the wisdom file wfn, which is
+	imported with the first plan; an empty name keeps no wisdom
+	must be called before the first call of fftplan_get
+*/
+void
+fftplan_init (const char *wfn, const char *rigor)
+{
+  unsigned i;
+
+  for (i = 0; i < sizeof (rigors) / sizeof (rigors[0]); i++)
+    if (strcmp (rigor, rigors[i].name) == 0)
+      break;
+  if (i == sizeof (rigors) / sizeof (rigors[0]))
+    gerror1 ("Unknown planning rigor %s", rigor);
+
+  pthread_mutex_lock (&lock);
+  rigorflag = rigors[i].flag;
+  hits = misses = 0;
+  strncpy (wisdomfn, wfn, FNLEN - 1);
+  wisdomfn[FNLEN - 1] = '\0';
+  pthread_mutex_unlock (&lock);
+}
+
+/*
+	returns the plan of kind FP_DFT or FP_R2C for howmany transforms of
+	length n, with the additional planner flags, e.g. FFTW_UNALIGNED;
+	the plan must be given back by fftplan_release
+*/
+const tFFTPLAN *
+fftplan_get (int kind, long long n, long long howmany, unsigned flags)
+{
+  tFFTPLAN *p;
+
+  pthread_mutex_lock (&lock);
+  for (p = head; p; p = p->next)
+    if (p->kind == kind && p->n == n && p->howmany == howmany
+	&& p->flags == flags)
+      break;
+  if (p)
+    {
+      hits++;
+      unlink_plan (p);
+    }
+  else
+    {
+      misses++;
+      p = (tFFTPLAN *) xmalloc (sizeof (tFFTPLAN));
+      p->kind = kind;
+      p->n = n;
+      p->howmany = howmany;
+      p->flags = flags;
+      p->refs = 0;
+      p->plan = make_plan (kind, n, howmany, flags);
+      nplans++;
+    }
+  p->refs++;
+  push_front (p);
+  evict ();
+  pthread_mutex_unlock (&lock);
+  return p;
+}
+
+/* gives back a plan obtained by fftplan_get */
+void
+fftplan_release (const tFFTPLAN * cp)
+{
+  tFFTPLAN *p = (tFFTPLAN *) cp;
+
+  pthread_mutex_lock (&lock);
+  p->refs--;
+  evict ();
+  pthread_mutex_unlock (&lock);
+}
+
+/* returns the number of plans reused and made since fftplan_init */
+void
+fftplan_stats (long *nhits, long *nmisses)
+{
+  pthread_mutex_lock (&lock);
+  *nhits = hits;
+  *nmisses = misses;
+  pthread_mutex_unlock (&lock);
+}
+
+/*
+	destroys all plans, no plan may be in use, and writes the wisdom
+	file if the plans have added to the wisdom, except for estimate
+*/
+void
+fftplan_free (void)
+{
+  tFFTPLAN *p;
+  FILE *wfp;
+  char tmp[FNLEN + 32];
+  char *w = NULL;
+
+  pthread_mutex_lock (&lock);
+  while ((p = head) != NULL)
+    {
+      unlink_plan (p);
+      fftw_destroy_plan (p->plan);
+      xfree (p);
+    }
+  nplans = 0;
+
+  if (wisdom_read && wisdomfn[0] != '\0' && rigorflag != FFTW_ESTIMATE)
+    w = fftw_export_wisdom_to_string ();
+  if (w && (wisdom0 == NULL || strcmp (w, wisdom0) != 0))
+    {
+      /* merge what other runs have written meanwhile */
+      if ((wfp = fopen (wisdomfn, "r")) != NULL)
+	{
+	  fftw_import_wisdom_from_file (wfp);
+	  fclose (wfp);
+	}
+      snprintf (tmp, sizeof (tmp), "%s.%ld.tmp", wisdomfn, (long) getpid ());
+      if ((wfp = fopen (tmp, "w")) == NULL)
+	message1 ("Cannot open '%s'", tmp);
+      else
+	{
+	  fftw_export_wisdom_to_file (wfp);
+	  if (fclose (wfp) != 0 || rename (tmp, wisdomfn) != 0)
+	    {
+	      message1 ("Cannot write '%s'", wisdomfn);
+	      unlink (tmp);
+	    }
+	}
+    }
+  free (w);
+  free (wisdom0);
+  wisdom0 = NULL;
+  wisdom_read = 0;
+  fftw_forget_wisdom ();
+  pthread_mutex_unlock (&lock);
+}
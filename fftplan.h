@@ -0,0 +1,29 @@
+#ifndef __fftplan_h
+#define __fftplan_h
+
+#include <fftw3.h>
+
+#define FP_DFT 0		/* forward complex DFT in place */
+#define FP_R2C 1		/* real to complex, howmany consecutive arrays */
+
+#define FPMAXPLANS 32		/* plans kept when not in use */
+
+typedef struct tFFTPLAN
+{
+  int kind;			/* FP_DFT or FP_R2C */
+  long long n;			/* length of the transform */
+  long long howmany;		/* number of transforms */
+  unsigned flags;		/* planner flags besides the rigor */
+  fftw_plan plan;
+  int refs;			/* number of users of this plan */
+  struct tFFTPLAN *prev, *next;	/* LRU list, most recently used first */
+} tFFTPLAN;
+
+void fftplan_init (const char *wfn, const char *rigor);
+const tFFTPLAN *fftplan_get (int kind, long long n, long long howmany,
+			     unsigned flags);
+void fftplan_release (const tFFTPLAN * p);
+void fftplan_stats (long *nhits, long *nmisses);
+void fftplan_free (void);
+
+#endif
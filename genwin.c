@@ -5,6 +5,7 @@
 #include <assert.h>
 #include "netlibi0.h"
 #include "genwin.h"
+#include "phasor.h"
 
 /* genwin.c created by merging sbwin.c and ghhwin.c to generate windows for 
    LPSD and FFT usage, Michael Troebs, 05/2004 */
@@ -58,8 +59,8 @@ output: char *name : Name of window function. space must be reserved
     	flatness: flatness for -0.5 <= f <=0.5 in dB
 	    
 	    
-void makewinsincos (int nfft, double bin, double *win, double *winsum, 
-    double *winsum2, double *nenbw);
+void makewinsincos (long long nfft, double bin, double *wcos, double *wsin,
+    double *winsum, double *winsum2, double *nenbw, double *w0, double *w1);
 
 makewin computes the actual window values and must be called
 after set_window. It must be re-called if either a new type
@@ -67,15 +68,45 @@ of window has been set with set_win or if NFFT has changed.
 
 input: nfft : length of FFT
        bin : (possibly non-integer) number of bin.
-output: win : the actual values of the window. Adequate space
-              must be reserved by the caller:
-	      size = 2*nfft 
-	      order: win[0]*cos, win[0]*sin, win[1]*cos, win[1]*sin, ...
+output: wcos, wsin : the window multiplied by cos and -sin of the
+	      DFT kernel (generated by phasor_fill, see phasor.c).
+	      Adequate space must be reserved by the caller:
+	      size = nfft each, preferably aligned for SIMD loads
+	      (see xmalloc_align)
+	      order: wcos[j] = win[j]*cos, wsin[j] = -win[j]*sin
 	winsum : sum of all window values. Even for half=1,
 	      the sum over all values 0...nfft-1 is returned
 	winsum2 : sum of all squared window values. Even for half=1,
 	      the sum over all values 0...nfft-1 is returned
 	nenbw : precise value of NENBW in bins	    
+	w0 : sum of win[j]*exp(-i*2*pi*bin*j/nfft) as w0[0] + i*w0[1]
+	w1 : sum of j*win[j]*exp(-i*2*pi*bin*j/nfft) as w1[0] + i*w1[1]
+	      The DFT of a straight line a + b*j is a*w0 + b*w1, so a 
+	      detrended DFT can be computed from the raw data.
+
+void modwinsincos (long long nfft, double bin, const double *win, double *wcos,
+    double *wsin, double *w0, double *w1);
+
+same as makewinsincos, but takes the window values win[0..nfft-1]
+from a previous call of makewin (nfft, 0, ...) instead of computing
+them. Only the complex exponential is evaluated.
+
+void makewinpart (long long nfft, long long j0, int n, double *win);
+
+computes the window values win[0..n-1] for the indices j0..j0+n-1 of a
+window of length nfft, for kernels that do not keep the whole window.
+
+void window_id (int *no, double *alpha);
+
+returns the window currently set by set_window: no = 0..30 for
+numbered windows, -1 for Kaiser with parameter alpha.
+
+int window_cosum (double *c);
+
+if the current window is a finite cosine sum
+win(z) = c[0] + c[1]*cos(2*pi*z) + ... + c[n-1]*cos(2*pi*(n-1)*z),
+copies c[0..n-1] (n <= MAXCOS) and returns n; returns 0 otherwise
+(Welch, Bartlett, Kaiser).
 
 */
 
@@ -124,6 +155,8 @@ struct window_t
   double sbin;
   int isft;
   double (*winfun) (double);
+  int ncos;			/* number of cosine terms, 0 if not a cosine sum */
+  double cosum[MAXCOS];		/* win(z) = sum cosum[k]*cos(2*pi*k*z) */
 };
 typedef struct window_t window;
 
@@ -137,42 +170,73 @@ Otherwise the ordering is unimportant.*/
 
 static const window winlist[] = {
 /* 0*/ {"Rectangular", 013.3, 00.0, 1.0000, 0.8845, -3.9224, 1.000, 0,
-	win_Rectangular},
-/* 1*/ {"Welch", 021.3, 29.3, 1.2000, 1.1535, -2.2248, 1.430, 0, win_Welch},
-/* 2*/ {"Bartlett", 026.5, 50.0, 1.3333, 1.2736, -1.8242, 2.000, 0, win_Bartlett},
-/* 3*/ {"Hanning", 031.5, 50.0, 1.5000, 1.4382, -1.4236, 2.000, 0, win_Hanning},
-/* 4*/ {"Hamming", 042.7, 50.0, 1.3628, 1.3008, -1.7514, 2.000, 0, win_Hamming},
-/* 5*/ {"Nuttall3", 046.7, 64.7, 1.9444, 1.8496, -0.8630, 3.000, 0, win_Nuttall3},
-/* 6*/ {"Nuttall4", 060.9, 70.5, 2.3100, 2.1884, -0.6184, 4.000, 0, win_Nuttall4},
+	win_Rectangular,
+	  1, {1}},
+/* 1*/ {"Welch", 021.3, 29.3, 1.2000, 1.1535, -2.2248, 1.430, 0, win_Welch,
+	  0, {0}},
+/* 2*/ {"Bartlett", 026.5, 50.0, 1.3333, 1.2736, -1.8242, 2.000, 0, win_Bartlett,
+	  0, {0}},
+/* 3*/ {"Hanning", 031.5, 50.0, 1.5000, 1.4382, -1.4236, 2.000, 0, win_Hanning,
+	  2, {0.5, -0.5}},
+/* 4*/ {"Hamming", 042.7, 50.0, 1.3628, 1.3008, -1.7514, 2.000, 0, win_Hamming,
+	  2, {0.54, -0.46}},
+/* 5*/ {"Nuttall3", 046.7, 64.7, 1.9444, 1.8496, -0.8630, 3.000, 0, win_Nuttall3,
+	  3, {0.375, -0.5, 0.125}},
+/* 6*/ {"Nuttall4", 060.9, 70.5, 2.3100, 2.1884, -0.6184, 4.000, 0, win_Nuttall4,
+	  4, {0.3125, -0.46875, 0.1875, -0.03125}},
 /* 7*/ {"Nuttall3a", 064.2, 61.2, 1.7721, 1.6828, -1.0453, 3.000, 0,
-	  win_Nuttall3a},
+	  win_Nuttall3a,
+	  3, {0.40897, -0.5, 0.09103}},
 /* 8*/ {"Nuttall3b", 071.5, 59.8, 1.7037, 1.6162, -1.1352, 3.000, 0,
-	  win_Nuttall3b},
+	  win_Nuttall3b,
+	  3, {0.4243801, -0.4973406, 0.0782793}},
 /* 9*/ {"Nuttall4a", 082.6, 68.0, 2.1253, 2.0123, -0.7321, 4.000, 0,
-	  win_Nuttall4a},
-/*10*/ {"BH92", 092.0, 66.1, 2.0044, 1.8962, -0.8256, 4.000, 0, win_BH92},
+	  win_Nuttall4a,
+	  4, {0.338946, -0.481973, 0.161054, -0.018027}},
+/*10*/ {"BH92", 092.0, 66.1, 2.0044, 1.8962, -0.8256, 4.000, 0, win_BH92,
+	  4, {0.35875, -0.48829, 0.14128, -0.01168}},
 /*11*/ {"Nuttall4b", 093.3, 66.3, 2.0212, 1.9122, -0.8118, 4.000, 0,
-	  win_Nuttall4b},
+	  win_Nuttall4b,
+	  4, {0.355768, -0.487396, 0.144232, -0.012604}},
 /*12*/ {"Nuttall4c", 098.1, 65.6, 1.9761, 1.8687, -0.8506, 4.000, 0,
-	  win_Nuttall4c},
-/*13*/ {"SFT3F", 031.7, 66.7, 3.1681, 3.1502, +0.0082, 3.000, 0, win_SFT3F},
-/*14*/ {"SFT3M", 044.2, 65.5, 2.9452, 2.9183, -0.0115, 3.000, 0, win_SFT3M},
-/*15*/ {"FTNI", 044.4, 65.6, 2.9656, 2.9355, +0.0169, 3.000, 0, win_FTNI},
-/*16*/ {"SFT4F", 044.7, 75.0, 3.7970, 3.7618, +0.0041, 4.000, 0, win_SFT4F},
-/*17*/ {"SFT5F", 057.3, 78.5, 4.3412, 4.2910, -0.0025, 5.000, 0, win_SFT5F},
-/*18*/ {"SFT4M", 066.5, 72.1, 3.3868, 3.3451, -0.0067, 4.000, 0, win_SFT4M},
-/*19*/ {"FTHP", 070.4, 72.3, 3.4279, 3.3846, +0.0096, 4.000, 0, win_FTHP},
-/*20*/ {"HFT70", 070.4, 72.2, 3.4129, 3.3720, -0.0065, 4.000, 0, win_HFT70},
-/*21*/ {"FTSRS", 076.6, 75.4, 3.7702, 3.7274, -0.0156, 4.719, 0, win_FTSRS},
-/*22*/ {"SFT5M", 089.9, 76.0, 3.8852, 3.8340, +0.0039, 5.000, 0, win_SFT5M},
-/*23*/ {"HFT90D", 090.2, 76.0, 3.8832, 3.8320, -0.0039, 5.000, 1, win_HFT90D},
-/*24*/ {"HFT95", 095.0, 75.6, 3.8112, 3.7590, +0.0044, 5.000, 0, win_HFT95},
-/*25*/ {"HFT116D", 116.8, 78.2, 4.2186, 4.1579, -0.0028, 6.000, 1, win_HFT116D},
-/*26*/ {"HFT144D", 144.1, 79.9, 4.5386, 4.4697, +0.0021, 7.000, 1, win_HFT144D},
-/*27*/ {"HFT169D", 169.5, 81.2, 4.8347, 4.7588, +0.0017, 8.000, 1, win_HFT169D},
-/*28*/ {"HFT196D", 196.2, 82.3, 5.1134, 5.0308, +0.0013, 9.000, 1, win_HFT196D},
-/*29*/ {"HFT223D", 223.0, 83.3, 5.3888, 5.3000, -0.0011, 10.000, 1, win_HFT223D},
-/*30*/ {"HFT248D", 248.4, 84.1, 5.6512, 5.5567, +0.0009, 11.000, 1, win_HFT248D}
+	  win_Nuttall4c,
+	  4, {0.3635819, -0.4891775, 0.1365995, -0.0106411}},
+/*13*/ {"SFT3F", 031.7, 66.7, 3.1681, 3.1502, +0.0082, 3.000, 0, win_SFT3F,
+	  3, {0.26526, -0.5, 0.23474}},
+/*14*/ {"SFT3M", 044.2, 65.5, 2.9452, 2.9183, -0.0115, 3.000, 0, win_SFT3M,
+	  3, {0.28235, -0.52105, 0.19659}},
+/*15*/ {"FTNI", 044.4, 65.6, 2.9656, 2.9355, +0.0169, 3.000, 0, win_FTNI,
+	  3, {0.2810639, -0.5208972, 0.1980399}},
+/*16*/ {"SFT4F", 044.7, 75.0, 3.7970, 3.7618, +0.0041, 4.000, 0, win_SFT4F,
+	  4, {0.21706, -0.42103, 0.28294, -0.07897}},
+/*17*/ {"SFT5F", 057.3, 78.5, 4.3412, 4.2910, -0.0025, 5.000, 0, win_SFT5F,
+	  5, {0.1881, -0.36923, 0.28702, -0.13077, 0.02488}},
+/*18*/ {"SFT4M", 066.5, 72.1, 3.3868, 3.3451, -0.0067, 4.000, 0, win_SFT4M,
+	  4, {0.241906, -0.460841, 0.255381, -0.041872}},
+/*19*/ {"FTHP", 070.4, 72.3, 3.4279, 3.3846, +0.0096, 4.000, 0, win_FTHP,
+	  4, {1.0, -1.912510941, 1.079173272, -0.1832630879}},
+/*20*/ {"HFT70", 070.4, 72.2, 3.4129, 3.3720, -0.0065, 4.000, 0, win_HFT70,
+	  4, {1, -1.90796, 1.07349, -0.18199}},
+/*21*/ {"FTSRS", 076.6, 75.4, 3.7702, 3.7274, -0.0156, 4.719, 0, win_FTSRS,
+	  5, {1.0, -1.93, 1.29, -0.388, 0.028}},
+/*22*/ {"SFT5M", 089.9, 76.0, 3.8852, 3.8340, +0.0039, 5.000, 0, win_SFT5M,
+	  5, {0.209671, -0.407331, 0.281225, -0.092669, 0.0091036}},
+/*23*/ {"HFT90D", 090.2, 76.0, 3.8832, 3.8320, -0.0039, 5.000, 1, win_HFT90D,
+	  5, {1, -1.942604, 1.340318, -0.440811, 0.043097}},
+/*24*/ {"HFT95", 095.0, 75.6, 3.8112, 3.7590, +0.0044, 5.000, 0, win_HFT95,
+	  5, {1, -1.9383379, 1.3045202, -0.4028270, 0.0350665}},
+/*25*/ {"HFT116D", 116.8, 78.2, 4.2186, 4.1579, -0.0028, 6.000, 1, win_HFT116D,
+	  6, {1, -1.9575375, 1.4780705, -0.6367431, 0.1228389, -0.0066288}},
+/*26*/ {"HFT144D", 144.1, 79.9, 4.5386, 4.4697, +0.0021, 7.000, 1, win_HFT144D,
+	  7, {1, -1.96760033, 1.57983607, -0.81123644, 0.22583558, -0.02773848, 0.00090360}},
+/*27*/ {"HFT169D", 169.5, 81.2, 4.8347, 4.7588, +0.0017, 8.000, 1, win_HFT169D,
+	  8, {1, -1.97441843, 1.65409889, -0.95788187, 0.33673420, -0.06364622, 0.00521942, -0.00010599}},
+/*28*/ {"HFT196D", 196.2, 82.3, 5.1134, 5.0308, +0.0013, 9.000, 1, win_HFT196D,
+	  9, {1, -1.979280420, 1.710288951, -1.081629853, 0.448734314, -0.112376628, 0.015122992, -0.000871252, 0.000011896}},
+/*29*/ {"HFT223D", 223.0, 83.3, 5.3888, 5.3000, -0.0011, 10.000, 1, win_HFT223D,
+	  10, {1, -1.98298997309, 1.75556083063, -1.19037717712, 0.56155440797, -0.17296769663, 0.03233247087, -0.00324954578, 0.00013801040, -0.00000132725}},
+/*30*/ {"HFT248D", 248.4, 84.1, 5.6512, 5.5567, +0.0009, 11.000, 1, win_HFT248D,
+	  11, {1, -1.985844164102, 1.791176438506, -1.282075284005, 0.667777530266, -0.240160796576, 0.056656381764, -0.008134974479, 0.000624544650, -0.000019808998, 0.000000132974}}
 };
 static const int nwinlist = sizeof (winlist) / sizeof (window);
 
@@ -596,21 +660,21 @@ set_window (int type, double req_psll, char *name, double *psll, double *rov,
 
 
 void
-makewinsincos (int nfft, double bin, double *win, double *winsum,
-	       double *winsum2, double *nenbw)
+makewinsincos (long long nfft, double bin, double *wcos, double *wsin,
+	       double *winsum, double *winsum2, double *nenbw,
+	       double *w0, double *w1)
 {
-  int j;
+  long long j;
   double kaiser_scal = 1, z;
   double winval;
-  double fact, arg;
-  double s,c;
+  long double w0re = 0, w0im = 0, w1re = 0, w1im = 0;
 
   *winsum = *winsum2 = 0;
   if (win_no == -2)
     gerror ("set_window has not been called.");
   if (win_no == -1)
     kaiser_scal = netlibi0 (M_PI * win_alpha);
-  fact = 2.0 * M_PI * bin / ((double) nfft);
+  phasor_fill (bin, nfft, 0, nfft, wcos, wsin);
   for (j = 0; j < nfft; j++)
     {
       if (win_no == -1)
@@ -627,24 +691,97 @@ makewinsincos (int nfft, double bin, double *win, double *winsum,
       *winsum += winval;
       *winsum2 += winval * winval;
 
-      arg = fact * (double) j;
-#ifdef SINCOS
-    asm ("fsincos": "=t" (c), "=u" (s):"0" (arg));
-#else
-      s = sin (arg);
-      c = cos (arg);
-#endif
-      *(win++) = c*winval;
-      *(win++) = -s*winval;
+      wcos[j] = wcos[j]*winval;
+      wsin[j] = -wsin[j]*winval;
+      w0re += wcos[j];
+      w0im += wsin[j];
+      w1re += (long double) j * wcos[j];
+      w1im += (long double) j * wsin[j];
     }
   *nenbw = nfft * *winsum2 / (*winsum * *winsum);
+  w0[0] = w0re;
+  w0[1] = w0im;
+  w1[0] = w1re;
+  w1[1] = w1im;
+}
+
+void
+modwinsincos (long long nfft, double bin, const double *win, double *wcos,
+	      double *wsin, double *w0, double *w1)
+{
+  long long j;
+  long double w0re = 0, w0im = 0, w1re = 0, w1im = 0;
+
+  phasor_fill (bin, nfft, 0, nfft, wcos, wsin);
+  for (j = 0; j < nfft; j++)
+    {
+      wcos[j] = wcos[j]*win[j];
+      wsin[j] = -wsin[j]*win[j];
+      w0re += wcos[j];
+      w0im += wsin[j];
+      w1re += (long double) j * wcos[j];
+      w1im += (long double) j * wsin[j];
+    }
+  w0[0] = w0re;
+  w0[1] = w0im;
+  w1[0] = w1re;
+  w1[1] = w1im;
+}
+
+void
+makewinpart (long long nfft, long long j0, int n, double *win)
+{
+  long long j;
+  double kaiser_scal = 1, z;
+
+  if (win_no == -2)
+    gerror ("set_window has not been called.");
+  if (win_no == -1)
+    kaiser_scal = netlibi0 (M_PI * win_alpha);
+  for (j = j0; j < j0 + n; j++)
+    {
+      if (win_no == -1)
+	{			/* Kaiser */
+	  z = 2. * (double) j / (double) nfft - 1.;
+	  win[j - j0] =
+	    netlibi0 (M_PI * win_alpha * sqrt (1 - z * z)) / kaiser_scal;
+	}
+      else
+	{
+	  z = (double) j / (double) nfft;
+	  win[j - j0] = (*(winlist[win_no].winfun)) (z);
+	}
+    }
+}
+
+int
+window_cosum (double *c)
+{
+  int k;
+
+  if (win_no == -2)
+    gerror ("set_window has not been called.");
+  if (win_no == -1)
+    return 0;
+  for (k = 0; k < winlist[win_no].ncos; k++)
+    c[k] = winlist[win_no].cosum[k];
+  return winlist[win_no].ncos;
+}
+
+void
+window_id (int *no, double *alpha)
+{
+  if (win_no == -2)
+    gerror ("set_window has not been called.");
+  *no = win_no;
+  *alpha = (win_no == -1) ? win_alpha : 0;
 }
 
 void
-makewin (int nfft, int half, double *win, double *winsum, double *winsum2,
-	 double *nenbw)
+makewin (long long nfft, int half, double *win, double *winsum,
+	 double *winsum2, double *nenbw)
 {
-  int j;
+  long long j;
   double kaiser_scal = 1, z;
 
   *winsum = *winsum2 = 0;
@@ -1,16 +1,28 @@
 #ifndef __genwin_h
 #define __genwin_h
 
+#define MAXCOS 11		/* max. number of terms of cosine-sum windows */
+
 /* ANSI prototypes of externally visible functions: */
 
 void set_window (int type, double req_psll, char *name, double *psll,
 		 double *rov, double *nenbw, double *w3db, double *flatness,
 		 double *sbin);
 
-void makewinsincos (int nfft, double bin, double *win, double *winsum,
-		    double *winsum2, double *nenbw);
+void makewinsincos (long long nfft, double bin, double *wcos, double *wsin,
+		    double *winsum, double *winsum2, double *nenbw,
+		    double *w0, double *w1);
 
-void makewin (int nfft, int half, double *win, double *winsum,
+void makewin (long long nfft, int half, double *win, double *winsum,
 	      double *winsum2, double *nenbw);
 
+void modwinsincos (long long nfft, double bin, const double *win,
+		   double *wcos, double *wsin, double *w0, double *w1);
+
+void makewinpart (long long nfft, long long j0, int n, double *win);
+
+void window_id (int *no, double *alpha);
+
+int window_cosum (double *c);
+
 #endif
@@ -1,1507 +1,86 @@
-#include "goodn.h"
+/********************************************************************************
+    goodn.c
+
+    FFT lengths for which FFTW is efficient: even n = 2^a 3^b 5^c 7^d m
+    with m = 1, 11 or 13
 
-static int goodn[] =
-  { 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 36, 40, 42,
-  44, 48, 50, 52, 54, 56, 60, 64, 66, 70, 72, 78, 80, 84, 88, 90, 96, 98,
-  100, 104, 108, 110, 112, 120, 126, 128, 130, 132, 140, 144, 150, 154,
-  156, 160, 162, 168, 176, 180, 182, 192, 196, 198, 200, 208, 210, 216,
-  220, 224, 234, 240, 250, 252, 256, 260, 264, 270, 280, 288, 294, 300,
-  308, 312, 320, 324, 330, 336, 350, 352, 360, 364, 378, 384, 390, 392,
-  396, 400, 416, 420, 432, 440, 448, 450, 462, 468, 480, 486, 490, 500,
-  504, 512, 520, 528, 540, 546, 550, 560, 576, 588, 594, 600, 616, 624,
-  630, 640, 648, 650, 660, 672, 686, 700, 702, 704, 720, 728, 750, 756,
-  768, 770, 780, 784, 792, 800, 810, 832, 840, 864, 880, 882, 896, 900,
-  910, 924, 936, 960, 972, 980, 990, 1000, 1008, 1024, 1040, 1050, 1056,
-  1078, 1080, 1092, 1100, 1120, 1134, 1152, 1170, 1176, 1188, 1200, 1232,
-  1248, 1250, 1260, 1274, 1280, 1296, 1300, 1320, 1344, 1350, 1372, 1386,
-  1400, 1404, 1408, 1440, 1456, 1458, 1470, 1500, 1512, 1536, 1540, 1560,
-  1568, 1584, 1600, 1620, 1638, 1650, 1664, 1680, 1728, 1750, 1760, 1764,
-  1782, 1792, 1800, 1820, 1848, 1872, 1890, 1920, 1944, 1950, 1960, 1980,
-  2000, 2016, 2048, 2058, 2080, 2100, 2106, 2112, 2156, 2160, 2184, 2200,
-  2240, 2250, 2268, 2304, 2310, 2340, 2352, 2376, 2400, 2430, 2450, 2464,
-  2496, 2500, 2520, 2548, 2560, 2592, 2600, 2640, 2646, 2688, 2700, 2730,
-  2744, 2750, 2772, 2800, 2808, 2816, 2880, 2912, 2916, 2940, 2970, 3000,
-  3024, 3072, 3080, 3120, 3136, 3150, 3168, 3200, 3234, 3240, 3250, 3276,
-  3300, 3328, 3360, 3402, 3430, 3456, 3500, 3510, 3520, 3528, 3564, 3584,
-  3600, 3640, 3696, 3744, 3750, 3780, 3822, 3840, 3850, 3888, 3900, 3920,
-  3960, 4000, 4032, 4050, 4096, 4116, 4158, 4160, 4200, 4212, 4224, 4312,
-  4320, 4368, 4374, 4400, 4410, 4480, 4500, 4536, 4550, 4608, 4620, 4680,
-  4704, 4752, 4800, 4802, 4860, 4900, 4914, 4928, 4950, 4992, 5000, 5040,
-  5096, 5120, 5184, 5200, 5250, 5280, 5292, 5346, 5376, 5390, 5400, 5460,
-  5488, 5500, 5544, 5600, 5616, 5632, 5670, 5760, 5824, 5832, 5850, 5880,
-  5940, 6000, 6048, 6144, 6160, 6174, 6240, 6250, 6272, 6300, 6318, 6336,
-  6370, 6400, 6468, 6480, 6500, 6552, 6600, 6656, 6720, 6750, 6804, 6860,
-  6912, 6930, 7000, 7020, 7040, 7056, 7128, 7168, 7200, 7280, 7290, 7350,
-  7392, 7488, 7500, 7546, 7560, 7644, 7680, 7700, 7776, 7800, 7840, 7920,
-  7938, 8000, 8064, 8100, 8190, 8192, 8232, 8250, 8316, 8320, 8400, 8424,
-  8448, 8624, 8640, 8736, 8748, 8750, 8800, 8820, 8910, 8918, 8960, 9000,
-  9072, 9100, 9216, 9240, 9360, 9408, 9450, 9504, 9600, 9604, 9702, 9720,
-  9750, 9800, 9828, 9856, 9900, 9984, 10000, 10080, 10192, 10206, 10240,
-  10290, 10368, 10400, 10500, 10530, 10560, 10584, 10692, 10752, 10780,
-  10800, 10920, 10976, 11000, 11088, 11200, 11232, 11250, 11264, 11340,
-  11466, 11520, 11550, 11648, 11664, 11700, 11760, 11880, 12000, 12096,
-  12150, 12250, 12288, 12320, 12348, 12474, 12480, 12500, 12544, 12600,
-  12636, 12672, 12740, 12800, 12936, 12960, 13000, 13104, 13122, 13200,
-  13230, 13312, 13440, 13500, 13608, 13650, 13720, 13750, 13824, 13860,
-  14000, 14040, 14080, 14112, 14256, 14336, 14400, 14406, 14560, 14580,
-  14700, 14742, 14784, 14850, 14976, 15000, 15092, 15120, 15288, 15360,
-  15400, 15552, 15600, 15680, 15750, 15840, 15876, 16000, 16038, 16128,
-  16170, 16200, 16250, 16380, 16384, 16464, 16500, 16632, 16640, 16800,
-  16848, 16896, 17010, 17150, 17248, 17280, 17472, 17496, 17500, 17550,
-  17600, 17640, 17820, 17836, 17920, 18000, 18144, 18200, 18432, 18480,
-  18522, 18720, 18750, 18816, 18900, 18954, 19008, 19110, 19200, 19208,
-  19250, 19404, 19440, 19500, 19600, 19656, 19712, 19800, 19968, 20000,
-  20160, 20250, 20384, 20412, 20480, 20580, 20736, 20790, 20800, 21000,
-  21060, 21120, 21168, 21384, 21504, 21560, 21600, 21840, 21870, 21952,
-  22000, 22050, 22176, 22400, 22464, 22500, 22528, 22638, 22680, 22750,
-  22932, 23040, 23100, 23296, 23328, 23400, 23520, 23760, 23814, 24000,
-  24010, 24192, 24300, 24500, 24570, 24576, 24640, 24696, 24750, 24948,
-  24960, 25000, 25088, 25200, 25272, 25344, 25480, 25600, 25872, 25920,
-  26000, 26208, 26244, 26250, 26400, 26460, 26624, 26730, 26754, 26880,
-  26950, 27000, 27216, 27300, 27440, 27500, 27648, 27720, 28000, 28080,
-  28160, 28224, 28350, 28512, 28672, 28800, 28812, 29106, 29120, 29160,
-  29250, 29400, 29484, 29568, 29700, 29952, 30000, 30184, 30240, 30576,
-  30618, 30720, 30800, 30870, 31104, 31200, 31250, 31360, 31500, 31590,
-  31680, 31752, 31850, 32000, 32076, 32256, 32340, 32400, 32500, 32760,
-  32768, 32928, 33000, 33264, 33280, 33600, 33614, 33696, 33750, 33792,
-  34020, 34300, 34398, 34496, 34560, 34650, 34944, 34992, 35000, 35100,
-  35200, 35280, 35640, 35672, 35840, 36000, 36288, 36400, 36450, 36750,
-  36864, 36960, 37044, 37422, 37440, 37500, 37632, 37730, 37800, 37908,
-  38016, 38220, 38400, 38416, 38500, 38808, 38880, 39000, 39200, 39312,
-  39366, 39424, 39600, 39690, 39936, 40000, 40320, 40500, 40768, 40824,
-  40950, 40960, 41160, 41250, 41472, 41580, 41600, 42000, 42120, 42240,
-  42336, 42768, 43008, 43120, 43200, 43218, 43680, 43740, 43750, 43904,
-  44000, 44100, 44226, 44352, 44550, 44590, 44800, 44928, 45000, 45056,
-  45276, 45360, 45500, 45864, 46080, 46200, 46592, 46656, 46800, 47040,
-  47250, 47520, 47628, 48000, 48020, 48114, 48384, 48510, 48600, 48750,
-  49000, 49140, 49152, 49280, 49392, 49500, 49896, 49920, 50000, 50176,
-  50400, 50544, 50688, 50960, 51030, 51200, 51450, 51744, 51840, 52000,
-  52416, 52488, 52500, 52650, 52800, 52822, 52920, 53248, 53460, 53508,
-  53760, 53900, 54000, 54432, 54600, 54880, 55000, 55296, 55440, 55566,
-  56000, 56160, 56250, 56320, 56448, 56700, 56862, 57024, 57330, 57344,
-  57600, 57624, 57750, 58212, 58240, 58320, 58500, 58800, 58968, 59136,
-  59400, 59904, 60000, 60368, 60480, 60750, 61152, 61236, 61250, 61440,
-  61600, 61740, 62208, 62370, 62400, 62426, 62500, 62720, 63000, 63180,
-  63360, 63504, 63700, 64000, 64152, 64512, 64680, 64800, 65000, 65520,
-  65536, 65610, 65856, 66000, 66150, 66528, 66560, 67200, 67228, 67392,
-  67500, 67584, 67914, 68040, 68250, 68600, 68750, 68796, 68992, 69120,
-  69300, 69888, 69984, 70000, 70200, 70400, 70560, 71280, 71344, 71442,
-  71680, 72000, 72030, 72576, 72800, 72900, 73500, 73710, 73728, 73920,
-  74088, 74250, 74844, 74880, 75000, 75264, 75460, 75600, 75816, 76032,
-  76440, 76800, 76832, 77000, 77616, 77760, 78000, 78400, 78624, 78732,
-  78750, 78848, 79200, 79380, 79872, 80000, 80190, 80262, 80640, 80850,
-  81000, 81250, 81536, 81648, 81900, 81920, 82320, 82500, 82944, 83160,
-  83200, 84000, 84240, 84480, 84672, 85050, 85536, 85750, 86016, 86240,
-  86400, 86436, 87318, 87360, 87480, 87500, 87750, 87808, 88000, 88200,
-  88452, 88704, 89100, 89180, 89600, 89856, 90000, 90112, 90552, 90720,
-  91000, 91728, 91854, 92160, 92400, 92610, 93184, 93312, 93600, 93750,
-  94080, 94500, 94770, 95040, 95256, 95550, 96000, 96040, 96228, 96250,
-  96768, 97020, 97200, 97500, 98000, 98280, 98304, 98560, 98784, 99000,
-  99792, 99840, 100000, 100352, 100800, 100842, 101088, 101250, 101376,
-  101920, 102060, 102400, 102900, 103194, 103488, 103680, 103950, 104000,
-  104832, 104976, 105000, 105300, 105600, 105644, 105840, 106496, 106920,
-  107016, 107520, 107800, 108000, 108864, 109200, 109350, 109760, 110000,
-  110250, 110592, 110880, 111132, 112000, 112266, 112320, 112500, 112640,
-  112896, 113190, 113400, 113724, 113750, 114048, 114660, 114688, 115200,
-  115248, 115500, 116424, 116480, 116640, 117000, 117600, 117936, 118098,
-  118272, 118800, 119070, 119808, 120000, 120050, 120736, 120960, 121500,
-  122304, 122472, 122500, 122850, 122880, 123200, 123480, 123750, 124416,
-  124740, 124800, 124852, 125000, 125440, 126000, 126360, 126720, 127008,
-  127400, 128000, 128304, 129024, 129360, 129600, 129654, 130000, 131040,
-  131072, 131220, 131250, 131712, 132000, 132300, 132678, 133056, 133120,
-  133650, 133770, 134400, 134456, 134750, 134784, 135000, 135168, 135828,
-  136080, 136500, 137200, 137500, 137592, 137984, 138240, 138600, 139776,
-  139968, 140000, 140400, 140800, 141120, 141750, 142560, 142688, 142884,
-  143360, 144000, 144060, 144342, 145152, 145530, 145600, 145800, 146250,
-  147000, 147420, 147456, 147840, 148176, 148500, 149688, 149760, 150000,
-  150528, 150920, 151200, 151632, 152064, 152880, 153090, 153600, 153664,
-  154000, 154350, 155232, 155520, 156000, 156250, 156800, 157248, 157464,
-  157500, 157696, 157950, 158400, 158466, 158760, 159250, 159744, 160000,
-  160380, 160524, 161280, 161700, 162000, 162500, 163072, 163296, 163800,
-  163840, 164640, 165000, 165888, 166320, 166400, 166698, 168000, 168070,
-  168480, 168750, 168960, 169344, 170100, 170586, 171072, 171500, 171990,
-  172032, 172480, 172800, 172872, 173250, 174636, 174720, 174960, 175000,
-  175500, 175616, 176000, 176400, 176904, 177408, 178200, 178360, 179200,
-  179712, 180000, 180224, 181104, 181440, 182000, 182250, 183456, 183708,
-  183750, 184320, 184800, 185220, 186368, 186624, 187110, 187200, 187278,
-  187500, 188160, 188650, 189000, 189540, 190080, 190512, 191100, 192000,
-  192080, 192456, 192500, 193536, 194040, 194400, 195000, 196000, 196560,
-  196608, 196830, 197120, 197568, 198000, 198450, 199584, 199680, 200000,
-  200704, 201600, 201684, 202176, 202500, 202752, 203742, 203840, 204120,
-  204750, 204800, 205800, 206250, 206388, 206976, 207360, 207900, 208000,
-  209664, 209952, 210000, 210600, 211200, 211288, 211680, 212992, 213840,
-  214032, 214326, 215040, 215600, 216000, 216090, 217728, 218400, 218700,
-  218750, 219520, 220000, 220500, 221130, 221184, 221760, 222264, 222750,
-  222950, 224000, 224532, 224640, 225000, 225280, 225792, 226380, 226800,
-  227448, 227500, 228096, 229320, 229376, 230400, 230496, 231000, 232848,
-  232960, 233280, 234000, 235200, 235298, 235872, 236196, 236250, 236544,
-  237600, 238140, 239616, 240000, 240100, 240570, 240786, 241472, 241920,
-  242550, 243000, 243750, 244608, 244944, 245000, 245700, 245760, 246400,
-  246960, 247500, 248832, 249480, 249600, 249704, 250000, 250880, 252000,
-  252720, 253440, 254016, 254800, 255150, 256000, 256608, 257250, 258048,
-  258720, 259200, 259308, 260000, 261954, 262080, 262144, 262440, 262500,
-  263250, 263424, 264000, 264110, 264600, 265356, 266112, 266240, 267300,
-  267540, 268800, 268912, 269500, 269568, 270000, 270336, 271656, 272160,
-  273000, 274400, 275000, 275184, 275562, 275968, 276480, 277200, 277830,
-  279552, 279936, 280000, 280800, 281250, 281600, 282240, 283500, 284310,
-  285120, 285376, 285768, 286650, 286720, 288000, 288120, 288684, 288750,
-  290304, 291060, 291200, 291600, 292500, 294000, 294840, 294912, 295680,
-  296352, 297000, 299376, 299520, 300000, 301056, 301840, 302400, 302526,
-  303264, 303750, 304128, 305760, 306180, 306250, 307200, 307328, 308000,
-  308700, 309582, 310464, 311040, 311850, 312000, 312130, 312500, 313600,
-  314496, 314928, 315000, 315392, 315900, 316800, 316932, 317520, 318500,
-  319488, 320000, 320760, 321048, 322560, 323400, 324000, 325000, 326144,
-  326592, 327600, 327680, 328050, 329280, 330000, 330750, 331776, 332640,
-  332800, 333396, 336000, 336140, 336798, 336960, 337500, 337920, 338688,
-  339570, 340200, 341172, 341250, 342144, 343000, 343750, 343980, 344064,
-  344960, 345600, 345744, 346500, 349272, 349440, 349920, 350000, 351000,
-  351232, 352000, 352800, 353808, 354294, 354816, 356400, 356720, 357210,
-  358400, 359424, 360000, 360150, 360448, 362208, 362880, 364000, 364500,
-  366912, 367416, 367500, 368550, 368640, 369600, 369754, 370440, 371250,
-  372736, 373248, 374220, 374400, 374556, 375000, 376320, 377300, 378000,
-  379080, 380160, 381024, 382200, 384000, 384160, 384912, 385000, 387072,
-  388080, 388800, 388962, 390000, 392000, 393120, 393216, 393660, 393750,
-  394240, 395136, 396000, 396900, 398034, 399168, 399360, 400000, 400950,
-  401310, 401408, 403200, 403368, 404250, 404352, 405000, 405504, 406250,
-  407484, 407680, 408240, 409500, 409600, 411600, 412500, 412776, 413952,
-  414720, 415800, 416000, 419328, 419904, 420000, 421200, 422400, 422576,
-  423360, 425250, 425984, 427680, 428064, 428652, 428750, 430080, 431200,
-  432000, 432180, 433026, 435456, 436590, 436800, 436982, 437400, 437500,
-  438750, 439040, 440000, 441000, 442260, 442368, 443520, 444528, 445500,
-  445900, 448000, 449064, 449280, 450000, 450560, 451584, 452760, 453600,
-  454896, 455000, 456192, 458640, 458752, 459270, 460800, 460992, 462000,
-  463050, 465696, 465920, 466560, 468000, 468750, 470400, 470596, 471744,
-  472392, 472500, 473088, 473850, 475200, 475398, 476280, 477750, 479232,
-  480000, 480200, 481140, 481250, 481572, 482944, 483840, 485100, 486000,
-  487500, 489216, 489888, 490000, 491400, 491520, 492800, 493920, 495000,
-  497664, 498960, 499200, 499408, 500000, 500094, 501760, 504000, 504210,
-  505440, 506250, 506880, 508032, 509600, 510300, 511758, 512000, 513216,
-  514500, 515970, 516096, 517440, 518400, 518616, 519750, 520000, 523908,
-  524160, 524288, 524880, 525000, 526500, 526848, 528000, 528220, 529200,
-  530712, 532224, 532480, 534600, 535080, 537600, 537824, 539000, 539136,
-  540000, 540672, 543312, 544320, 546000, 546750, 548800, 550000, 550368,
-  551124, 551250, 551936, 552960, 554400, 555660, 559104, 559872, 560000,
-  561330, 561600, 561834, 562500, 563200, 564480, 565950, 567000, 568620,
-  568750, 570240, 570752, 571536, 573300, 573440, 576000, 576240, 577368,
-  577500, 580608, 582120, 582400, 583200, 585000, 588000, 589680, 589824,
-  590490, 591360, 592704, 594000, 595350, 598752, 599040, 600000, 600250,
-  602112, 603680, 604800, 605052, 606528, 607500, 608256, 611226, 611520,
-  612360, 612500, 614250, 614400, 614656, 616000, 617400, 618750, 619164,
-  620928, 622080, 623700, 624000, 624260, 625000, 627200, 628992, 629856,
-  630000, 630784, 631800, 633600, 633864, 635040, 637000, 638976, 640000,
-  641520, 642096, 642978, 645120, 646800, 648000, 648270, 650000, 652288,
-  653184, 655200, 655360, 656100, 656250, 658560, 660000, 661500, 663390,
-  663552, 665280, 665600, 666792, 668250, 668850, 672000, 672280, 673596,
-  673750, 673920, 675000, 675840, 677376, 679140, 680400, 682344, 682500,
-  684288, 686000, 687500, 687960, 688128, 689920, 691200, 691488, 693000,
-  698544, 698880, 699840, 700000, 702000, 702464, 704000, 705600, 705894,
-  707616, 708588, 708750, 709632, 712800, 713440, 714420, 716800, 718848,
-  720000, 720300, 720896, 721710, 722358, 724416, 725760, 727650, 728000,
-  729000, 731250, 733824, 734832, 735000, 737100, 737280, 739200, 739508,
-  740880, 742500, 745472, 746496, 748440, 748800, 749112, 750000, 752640,
-  754600, 756000, 758160, 760320, 762048, 764400, 765450, 768000, 768320,
-  769824, 770000, 771750, 774144, 776160, 777600, 777924, 780000, 781250,
-  784000, 785862, 786240, 786432, 787320, 787500, 788480, 789750, 790272,
-  792000, 792330, 793800, 796068, 796250, 798336, 798720, 800000, 801900,
-  802620, 802816, 806400, 806736, 808500, 808704, 810000, 811008, 812500,
-  814968, 815360, 816480, 819000, 819200, 823200, 825000, 825552, 826686,
-  827904, 829440, 831600, 832000, 833490, 838656, 839808, 840000, 840350,
-  842400, 843750, 844800, 845152, 846720, 850500, 851968, 852930, 855360,
-  856128, 857304, 857500, 859950, 860160, 862400, 864000, 864360, 866052,
-  866250, 870912, 873180, 873600, 873964, 874800, 875000, 877500, 878080,
-  880000, 882000, 884520, 884736, 887040, 889056, 891000, 891800, 896000,
-  898128, 898560, 900000, 901120, 903168, 905520, 907200, 907578, 909792,
-  910000, 911250, 912384, 917280, 917504, 918540, 918750, 921600, 921984,
-  924000, 926100, 928746, 931392, 931840, 933120, 935550, 936000, 936390,
-  937500, 940800, 941192, 943250, 943488, 944784, 945000, 946176, 947700,
-  950400, 950796, 952560, 955500, 958464, 960000, 960400, 962280, 962500,
-  963144, 965888, 967680, 970200, 972000, 975000, 978432, 979776, 980000,
-  982800, 983040, 984150, 985600, 987840, 990000, 992250, 995328, 997920,
-  998400, 998816, 1000000, 1000188, 1003520, 1008000, 1008420, 1010394,
-  1010880, 1012500, 1013760, 1016064, 1018710, 1019200, 1020600, 1023516,
-  1023750, 1024000, 1026432, 1029000, 1031250, 1031940, 1032192, 1034880,
-  1036800, 1037232, 1039500, 1040000, 1047816, 1048320, 1048576, 1049760,
-  1050000, 1053000, 1053696, 1056000, 1056440, 1058400, 1061424, 1062882,
-  1064448, 1064960, 1069200, 1070160, 1071630, 1075200, 1075648, 1078000,
-  1078272, 1080000, 1080450, 1081344, 1086624, 1088640, 1092000, 1093500,
-  1093750, 1097600, 1100000, 1100736, 1102248, 1102500, 1103872, 1105650,
-  1105920, 1108800, 1109262, 1111320, 1113750, 1114750, 1118208, 1119744,
-  1120000, 1122660, 1123200, 1123668, 1125000, 1126400, 1128960, 1131900,
-  1134000, 1137240, 1137500, 1140480, 1141504, 1143072, 1146600, 1146880,
-  1152000, 1152480, 1154736, 1155000, 1161216, 1164240, 1164800, 1166400,
-  1166886, 1170000, 1176000, 1176490, 1179360, 1179648, 1180980, 1181250,
-  1182720, 1185408, 1188000, 1190700, 1194102, 1197504, 1198080, 1200000,
-  1200500, 1202850, 1203930, 1204224, 1207360, 1209600, 1210104, 1212750,
-  1213056, 1215000, 1216512, 1218750, 1222452, 1223040, 1224720, 1225000,
-  1228500, 1228800, 1229312, 1232000, 1234800, 1237500, 1238328, 1241856,
-  1244160, 1247400, 1248000, 1248520, 1250000, 1254400, 1257984, 1259712,
-  1260000, 1261568, 1263600, 1267200, 1267728, 1270080, 1274000, 1275750,
-  1277952, 1280000, 1283040, 1284192, 1285956, 1286250, 1290240, 1293600,
-  1296000, 1296540, 1299078, 1300000, 1304576, 1306368, 1309770, 1310400,
-  1310720, 1310946, 1312200, 1312500, 1316250, 1317120, 1320000, 1320550,
-  1323000, 1326780, 1327104, 1330560, 1331200, 1333584, 1336500, 1337700,
-  1344000, 1344560, 1347192, 1347500, 1347840, 1350000, 1351680, 1354752,
-  1358280, 1360800, 1364688, 1365000, 1368576, 1372000, 1375000, 1375920,
-  1376256, 1377810, 1379840, 1382400, 1382976, 1386000, 1389150, 1397088,
-  1397760, 1399680, 1400000, 1404000, 1404928, 1406250, 1408000, 1411200,
-  1411788, 1415232, 1417176, 1417500, 1419264, 1421550, 1425600, 1426194,
-  1426880, 1428840, 1433250, 1433600, 1437696, 1440000, 1440600, 1441792,
-  1443420, 1443750, 1444716, 1448832, 1451520, 1455300, 1456000, 1458000,
-  1462500, 1467648, 1469664, 1470000, 1474200, 1474560, 1478400, 1479016,
-  1481760, 1485000, 1490944, 1492992, 1496880, 1497600, 1498224, 1500000,
-  1500282, 1505280, 1509200, 1512000, 1512630, 1516320, 1518750, 1520640,
-  1524096, 1528800, 1530900, 1531250, 1535274, 1536000, 1536640, 1539648,
-  1540000, 1543500, 1547910, 1548288, 1552320, 1555200, 1555848, 1559250,
-  1560000, 1560650, 1562500, 1568000, 1571724, 1572480, 1572864, 1574640,
-  1575000, 1576960, 1579500, 1580544, 1584000, 1584660, 1587600, 1592136,
-  1592500, 1596672, 1597440, 1600000, 1603800, 1605240, 1605632, 1612800,
-  1613472, 1617000, 1617408, 1620000, 1622016, 1625000, 1629936, 1630720,
-  1632960, 1638000, 1638400, 1640250, 1646400, 1647086, 1650000, 1651104,
-  1653372, 1653750, 1655808, 1658880, 1663200, 1664000, 1666980, 1677312,
-  1679616, 1680000, 1680700, 1683990, 1684800, 1685502, 1687500, 1689600,
-  1690304, 1693440, 1697850, 1701000, 1703936, 1705860, 1706250, 1710720,
-  1712256, 1714608, 1715000, 1718750, 1719900, 1720320, 1724800, 1728000,
-  1728720, 1732104, 1732500, 1741824, 1746360, 1747200, 1747928, 1749600,
-  1750000, 1755000, 1756160, 1760000, 1764000, 1769040, 1769472, 1771470,
-  1774080, 1778112, 1782000, 1783600, 1786050, 1792000, 1796256, 1797120,
-  1800000, 1800750, 1802240, 1806336, 1811040, 1814400, 1815156, 1819584,
-  1820000, 1822500, 1824768, 1833678, 1834560, 1835008, 1837080, 1837500,
-  1842750, 1843200, 1843968, 1848000, 1848770, 1852200, 1856250, 1857492,
-  1862784, 1863680, 1866240, 1871100, 1872000, 1872780, 1875000, 1881600,
-  1882384, 1886500, 1886976, 1889568, 1890000, 1892352, 1895400, 1900800,
-  1901592, 1905120, 1911000, 1916928, 1920000, 1920800, 1924560, 1925000,
-  1926288, 1928934, 1931776, 1935360, 1940400, 1944000, 1944810, 1950000,
-  1956864, 1959552, 1960000, 1965600, 1966080, 1968300, 1968750, 1971200,
-  1975680, 1980000, 1984500, 1990170, 1990656, 1995840, 1996800, 1997632,
-  2000000, 2000376, 2004750, 2006550, 2007040, 2016000, 2016840, 2020788,
-  2021250, 2021760, 2025000, 2027520, 2031250, 2032128, 2037420, 2038400,
-  2041200, 2047032, 2047500, 2048000, 2052864, 2058000, 2062500, 2063880,
-  2064384, 2069760, 2073600, 2074464, 2079000, 2080000, 2095632, 2096640,
-  2097152, 2099520, 2100000, 2106000, 2107392, 2112000, 2112880, 2116800,
-  2117682, 2122848, 2125764, 2126250, 2128896, 2129920, 2138400, 2140320,
-  2143260, 2143750, 2150400, 2151296, 2156000, 2156544, 2160000, 2160900,
-  2162688, 2165130, 2167074, 2173248, 2177280, 2182950, 2184000, 2184910,
-  2187000, 2187500, 2193750, 2195200, 2200000, 2201472, 2204496, 2205000,
-  2207744, 2211300, 2211840, 2217600, 2218524, 2222640, 2227500, 2229500,
-  2236416, 2239488, 2240000, 2245320, 2246400, 2247336, 2250000, 2252800,
-  2257920, 2263800, 2268000, 2274480, 2275000, 2280960, 2283008, 2286144,
-  2293200, 2293760, 2296350, 2304000, 2304960, 2309472, 2310000, 2315250,
-  2322432, 2328480, 2329600, 2332800, 2333772, 2340000, 2343750, 2352000,
-  2352980, 2357586, 2358720, 2359296, 2361960, 2362500, 2365440, 2369250,
-  2370816, 2376000, 2376990, 2381400, 2388204, 2388750, 2395008, 2396160,
-  2400000, 2401000, 2405700, 2406250, 2407860, 2408448, 2414720, 2419200,
-  2420208, 2425500, 2426112, 2430000, 2433024, 2437500, 2444904, 2446080,
-  2449440, 2450000, 2457000, 2457600, 2458624, 2464000, 2469600, 2475000,
-  2476656, 2480058, 2483712, 2488320, 2494800, 2496000, 2497040, 2500000,
-  2500470, 2508800, 2515968, 2519424, 2520000, 2521050, 2523136, 2527200,
-  2531250, 2534400, 2535456, 2540160, 2548000, 2551500, 2555904, 2558790,
-  2560000, 2566080, 2568384, 2571912, 2572500, 2579850, 2580480, 2587200,
-  2588278, 2592000, 2593080, 2598156, 2598750, 2600000, 2609152, 2612736,
-  2619540, 2620800, 2621440, 2621892, 2624400, 2625000, 2632500, 2634240,
-  2640000, 2641100, 2646000, 2653560, 2654208, 2661120, 2662400, 2667168,
-  2673000, 2675400, 2688000, 2689120, 2694384, 2695000, 2695680, 2700000,
-  2703360, 2709504, 2716560, 2721600, 2722734, 2729376, 2730000, 2733750,
-  2737152, 2744000, 2750000, 2751840, 2752512, 2755620, 2756250, 2759680,
-  2764800, 2765952, 2772000, 2778300, 2786238, 2794176, 2795520, 2799360,
-  2800000, 2806650, 2808000, 2809170, 2809856, 2812500, 2816000, 2822400,
-  2823576, 2829750, 2830464, 2834352, 2835000, 2838528, 2843100, 2843750,
-  2851200, 2852388, 2853760, 2857680, 2866500, 2867200, 2875392, 2880000,
-  2881200, 2883584, 2886840, 2887500, 2889432, 2897664, 2903040, 2910600,
-  2912000, 2916000, 2925000, 2935296, 2939328, 2940000, 2948400, 2949120,
-  2952450, 2956800, 2958032, 2963520, 2970000, 2976750, 2981888, 2985984,
-  2993760, 2995200, 2996448, 3000000, 3000564, 3001250, 3010560, 3018400,
-  3024000, 3025260, 3031182, 3032640, 3037500, 3041280, 3048192, 3056130,
-  3057600, 3058874, 3061800, 3062500, 3070548, 3071250, 3072000, 3073280,
-  3079296, 3080000, 3087000, 3093750, 3095820, 3096576, 3104640, 3110400,
-  3111696, 3118500, 3120000, 3121300, 3125000, 3136000, 3143448, 3144960,
-  3145728, 3149280, 3150000, 3153920, 3159000, 3161088, 3168000, 3169320,
-  3175200, 3184272, 3185000, 3188646, 3193344, 3194880, 3200000, 3207600,
-  3210480, 3211264, 3214890, 3225600, 3226944, 3234000, 3234816, 3240000,
-  3241350, 3244032, 3250000, 3259872, 3261440, 3265920, 3276000, 3276800,
-  3280500, 3281250, 3292800, 3294172, 3300000, 3302208, 3306744, 3307500,
-  3311616, 3316950, 3317760, 3326400, 3327786, 3328000, 3333960, 3341250,
-  3344250, 3354624, 3359232, 3360000, 3361400, 3367980, 3368750, 3369600,
-  3371004, 3375000, 3379200, 3380608, 3386880, 3395700, 3402000, 3407872,
-  3411720, 3412500, 3421440, 3424512, 3429216, 3430000, 3437500, 3439800,
-  3440640, 3449600, 3456000, 3457440, 3464208, 3465000, 3483648, 3492720,
-  3494400, 3495856, 3499200, 3500000, 3500658, 3510000, 3512320, 3520000,
-  3528000, 3529470, 3538080, 3538944, 3542940, 3543750, 3548160, 3556224,
-  3564000, 3567200, 3572100, 3582306, 3584000, 3592512, 3594240, 3600000,
-  3601500, 3604480, 3608550, 3611790, 3612672, 3622080, 3628800, 3630312,
-  3638250, 3639168, 3640000, 3645000, 3649536, 3656250, 3667356, 3669120,
-  3670016, 3674160, 3675000, 3685500, 3686400, 3687936, 3696000, 3697540,
-  3704400, 3712500, 3714984, 3725568, 3727360, 3732480, 3742200, 3744000,
-  3745560, 3750000, 3763200, 3764768, 3773000, 3773952, 3779136, 3780000,
-  3784704, 3790800, 3801600, 3803184, 3810240, 3822000, 3827250, 3833856,
-  3840000, 3841600, 3849120, 3850000, 3852576, 3857868, 3858750, 3863552,
-  3870720, 3880800, 3888000, 3889620, 3897234, 3900000, 3906250, 3913728,
-  3919104, 3920000, 3929310, 3931200, 3932160, 3932838, 3936600, 3937500,
-  3942400, 3948750, 3951360, 3960000, 3961650, 3969000, 3980340, 3981250,
-  3981312, 3991680, 3993600, 3995264, 4000000, 4000752, 4009500, 4013100,
-  4014080, 4032000, 4033680, 4041576, 4042500, 4043520, 4050000, 4055040,
-  4062500, 4064256, 4074840, 4076800, 4082400, 4094064, 4095000, 4096000,
-  4105728, 4116000, 4125000, 4127760, 4128768, 4133430, 4139520, 4147200,
-  4148928, 4158000, 4160000, 4167450, 4191264, 4193280, 4194304, 4199040,
-  4200000, 4201750, 4212000, 4214784, 4218750, 4224000, 4225760, 4233600,
-  4235364, 4245696, 4251528, 4252500, 4257792, 4259840, 4264650, 4276800,
-  4278582, 4280640, 4286520, 4287500, 4299750, 4300800, 4302592, 4312000,
-  4313088, 4320000, 4321800, 4325376, 4330260, 4331250, 4334148, 4346496,
-  4354560, 4365900, 4368000, 4369820, 4374000, 4375000, 4387500, 4390400,
-  4400000, 4402944, 4408992, 4410000, 4415488, 4422600, 4423680, 4435200,
-  4437048, 4445280, 4455000, 4459000, 4472832, 4478976, 4480000, 4490640,
-  4492800, 4494672, 4500000, 4500846, 4505600, 4515840, 4527600, 4536000,
-  4537890, 4548960, 4550000, 4556250, 4561920, 4566016, 4572288, 4586400,
-  4587520, 4592700, 4593750, 4605822, 4608000, 4609920, 4618944, 4620000,
-  4630500, 4643730, 4644864, 4656960, 4659200, 4665600, 4667544, 4677750,
-  4680000, 4681950, 4687500, 4704000, 4705960, 4715172, 4716250, 4717440,
-  4718592, 4723920, 4725000, 4730880, 4738500, 4741632, 4752000, 4753980,
-  4762800, 4776408, 4777500, 4790016, 4792320, 4800000, 4802000, 4811400,
-  4812500, 4815720, 4816896, 4829440, 4838400, 4840416, 4851000, 4852224,
-  4860000, 4866048, 4875000, 4889808, 4892160, 4898880, 4900000, 4914000,
-  4915200, 4917248, 4920750, 4928000, 4939200, 4941258, 4950000, 4953312,
-  4960116, 4961250, 4967424, 4976640, 4989600, 4992000, 4994080, 5000000,
-  5000940, 5017600, 5031936, 5038848, 5040000, 5042100, 5046272, 5051970,
-  5054400, 5056506, 5062500, 5068800, 5070912, 5080320, 5093550, 5096000,
-  5103000, 5111808, 5117580, 5118750, 5120000, 5132160, 5136768, 5143824,
-  5145000, 5156250, 5159700, 5160960, 5174400, 5176556, 5184000, 5186160,
-  5196312, 5197500, 5200000, 5218304, 5225472, 5239080, 5241600, 5242880,
-  5243784, 5248800, 5250000, 5265000, 5268480, 5280000, 5282200, 5292000,
-  5307120, 5308416, 5314410, 5322240, 5324800, 5334336, 5346000, 5350800,
-  5358150, 5376000, 5378240, 5388768, 5390000, 5391360, 5400000, 5402250,
-  5406720, 5419008, 5433120, 5443200, 5445468, 5458752, 5460000, 5467500,
-  5468750, 5474304, 5488000, 5500000, 5501034, 5503680, 5505024, 5511240,
-  5512500, 5519360, 5528250, 5529600, 5531904, 5544000, 5546310, 5556600,
-  5568750, 5572476, 5573750, 5588352, 5591040, 5598720, 5600000, 5613300,
-  5616000, 5618340, 5619712, 5625000, 5632000, 5644800, 5647152, 5659500,
-  5660928, 5668704, 5670000, 5677056, 5686200, 5687500, 5702400, 5704776,
-  5707520, 5715360, 5733000, 5734400, 5750784, 5760000, 5762400, 5767168,
-  5773680, 5775000, 5778864, 5786802, 5795328, 5806080, 5821200, 5824000,
-  5832000, 5834430, 5850000, 5870592, 5878656, 5880000, 5882450, 5896800,
-  5898240, 5904900, 5906250, 5913600, 5916064, 5927040, 5940000, 5953500,
-  5963776, 5970510, 5971968, 5987520, 5990400, 5992896, 6000000, 6001128,
-  6002500, 6014250, 6019650, 6021120, 6036800, 6048000, 6050520, 6062364,
-  6063750, 6065280, 6075000, 6082560, 6093750, 6096384, 6112260, 6115200,
-  6117748, 6123600, 6125000, 6141096, 6142500, 6144000, 6146560, 6158592,
-  6160000, 6174000, 6187500, 6191640, 6193152, 6209280, 6220800, 6223392,
-  6237000, 6240000, 6242600, 6250000, 6272000, 6286896, 6289920, 6291456,
-  6298560, 6300000, 6307840, 6318000, 6322176, 6336000, 6338640, 6350400,
-  6353046, 6368544, 6370000, 6377292, 6378750, 6386688, 6389760, 6400000,
-  6415200, 6420960, 6422528, 6429780, 6431250, 6451200, 6453888, 6468000,
-  6469632, 6480000, 6482700, 6488064, 6495390, 6500000, 6501222, 6519744,
-  6522880, 6531840, 6548850, 6552000, 6553600, 6554730, 6561000, 6562500,
-  6581250, 6585600, 6588344, 6600000, 6602750, 6604416, 6613488, 6615000,
-  6623232, 6633900, 6635520, 6652800, 6655572, 6656000, 6667920, 6682500,
-  6688500, 6709248, 6718464, 6720000, 6722800, 6735960, 6737500, 6739200,
-  6742008, 6750000, 6758400, 6761216, 6773760, 6791400, 6804000, 6815744,
-  6823440, 6825000, 6842880, 6849024, 6858432, 6860000, 6875000, 6879600,
-  6881280, 6889050, 6899200, 6912000, 6914880, 6928416, 6930000, 6945750,
-  6967296, 6985440, 6988800, 6991712, 6998400, 7000000, 7001316, 7020000,
-  7024640, 7031250, 7040000, 7056000, 7058940, 7072758, 7076160, 7077888,
-  7085880, 7087500, 7096320, 7107750, 7112448, 7128000, 7130970, 7134400,
-  7144200, 7164612, 7166250, 7168000, 7185024, 7188480, 7200000, 7203000,
-  7208960, 7217100, 7218750, 7223580, 7225344, 7244160, 7257600, 7260624,
-  7276500, 7278336, 7280000, 7290000, 7299072, 7312500, 7334712, 7338240,
-  7340032, 7348320, 7350000, 7371000, 7372800, 7375872, 7392000, 7395080,
-  7408800, 7425000, 7429968, 7440174, 7451136, 7454720, 7464960, 7484400,
-  7488000, 7491120, 7500000, 7501410, 7526400, 7529536, 7546000, 7547904,
-  7558272, 7560000, 7563150, 7569408, 7581600, 7593750, 7603200, 7606368,
-  7620480, 7644000, 7654500, 7656250, 7667712, 7676370, 7680000, 7683200,
-  7698240, 7700000, 7705152, 7715736, 7717500, 7727104, 7739550, 7741440,
-  7761600, 7764834, 7776000, 7779240, 7794468, 7796250, 7800000, 7803250,
-  7812500, 7827456, 7838208, 7840000, 7858620, 7862400, 7864320, 7865676,
-  7873200, 7875000, 7884800, 7897500, 7902720, 7920000, 7923300, 7938000,
-  7960680, 7962500, 7962624, 7983360, 7987200, 7990528, 8000000, 8001504,
-  8019000, 8026200, 8028160, 8064000, 8067360, 8083152, 8085000, 8087040,
-  8100000, 8110080, 8125000, 8128512, 8149680, 8153600, 8164800, 8168202,
-  8188128, 8190000, 8192000, 8201250, 8211456, 8232000, 8235430, 8250000,
-  8255520, 8257536, 8266860, 8268750, 8279040, 8294400, 8297856, 8316000,
-  8320000, 8334900, 8358714, 8382528, 8386560, 8388608, 8398080, 8400000,
-  8403500, 8419950, 8424000, 8427510, 8429568, 8437500, 8448000, 8451520,
-  8467200, 8470728, 8489250, 8491392, 8503056, 8505000, 8515584, 8519680,
-  8529300, 8531250, 8553600, 8557164, 8561280, 8573040, 8575000, 8593750,
-  8599500, 8601600, 8605184, 8624000, 8626176, 8640000, 8643600, 8650752,
-  8660520, 8662500, 8668296, 8692992, 8709120, 8731800, 8736000, 8739640,
-  8748000, 8750000, 8775000, 8780800, 8800000, 8805888, 8817984, 8820000,
-  8830976, 8845200, 8847360, 8857350, 8870400, 8874096, 8890560, 8910000,
-  8918000, 8930250, 8945664, 8957952, 8960000, 8981280, 8985600, 8989344,
-  9000000, 9001692, 9003750, 9011200, 9031680, 9055200, 9072000, 9075780,
-  9093546, 9097920, 9100000, 9112500, 9123840, 9132032, 9144576, 9168390,
-  9172800, 9175040, 9176622, 9185400, 9187500, 9211644, 9213750, 9216000,
-  9219840, 9237888, 9240000, 9243850, 9261000, 9281250, 9287460, 9289728,
-  9313920, 9318400, 9331200, 9335088, 9355500, 9360000, 9363900, 9375000,
-  9408000, 9411920, 9430344, 9432500, 9434880, 9437184, 9447840, 9450000,
-  9461760, 9477000, 9483264, 9504000, 9507960, 9525600, 9552816, 9555000,
-  9565938, 9580032, 9584640, 9600000, 9604000, 9622800, 9625000, 9631440,
-  9633792, 9644670, 9658880, 9676800, 9680832, 9702000, 9704448, 9720000,
-  9724050, 9732096, 9750000, 9779616, 9784320, 9797760, 9800000, 9828000,
-  9830400, 9834496, 9841500, 9843750, 9856000, 9878400, 9882516, 9900000,
-  9906624, 9920232, 9922500, 9934848, 9950850, 9953280, 9979200, 9983358,
-  9984000, 9988160, 10000000, 10001880, 10023750, 10032750, 10035200,
-  10063872, 10077696, 10080000, 10084200, 10092544, 10103940, 10106250,
-  10108800, 10113012, 10125000, 10137600, 10141824, 10156250, 10160640,
-  10187100, 10192000, 10206000, 10223616, 10235160, 10237500, 10240000,
-  10264320, 10273536, 10287648, 10290000, 10312500, 10319400, 10321920,
-  10348800, 10353112, 10368000, 10372320, 10392624, 10395000, 10400000,
-  10436608, 10450944, 10478160, 10483200, 10485760, 10487568, 10497600,
-  10500000, 10501974, 10530000, 10536960, 10560000, 10564400, 10584000,
-  10588410, 10614240, 10616832, 10628820, 10631250, 10644480, 10649600,
-  10668672, 10692000, 10701600, 10716300, 10718750, 10746918, 10752000,
-  10756480, 10777536, 10780000, 10782720, 10800000, 10804500, 10813440,
-  10825650, 10835370, 10838016, 10866240, 10886400, 10890936, 10914750,
-  10917504, 10920000, 10924550, 10935000, 10937500, 10948608, 10968750,
-  10976000, 11000000, 11002068, 11007360, 11010048, 11022480, 11025000,
-  11038720, 11056500, 11059200, 11063808, 11088000, 11092620, 11113200,
-  11137500, 11144952, 11147500, 11176704, 11182080, 11197440, 11200000,
-  11226600, 11232000, 11236680, 11239424, 11250000, 11264000, 11289600,
-  11294304, 11319000, 11321856, 11337408, 11340000, 11354112, 11372400,
-  11375000, 11404800, 11409552, 11415040, 11430720, 11466000, 11468800,
-  11481750, 11501568, 11520000, 11524800, 11529602, 11534336, 11547360,
-  11550000, 11557728, 11573604, 11576250, 11590656, 11612160, 11642400,
-  11648000, 11664000, 11668860, 11691702, 11700000, 11718750, 11741184,
-  11757312, 11760000, 11764900, 11787930, 11793600, 11796480, 11798514,
-  11809800, 11812500, 11827200, 11832128, 11846250, 11854080, 11880000,
-  11884950, 11907000, 11927552, 11941020, 11943750, 11943936, 11975040,
-  11980800, 11985792, 12000000, 12002256, 12005000, 12028500, 12031250,
-  12039300, 12042240, 12073600, 12096000, 12101040, 12124728, 12127500,
-  12130560, 12150000, 12165120, 12187500, 12192768, 12224520, 12230400,
-  12235496, 12247200, 12250000, 12282192, 12285000, 12288000, 12293120,
-  12317184, 12320000, 12348000, 12375000, 12383280, 12386304, 12400290,
-  12418560, 12441600, 12446784, 12474000, 12480000, 12485200, 12500000,
-  12502350, 12544000, 12573792, 12579840, 12582912, 12597120, 12600000,
-  12605250, 12615680, 12636000, 12644352, 12656250, 12672000, 12677280,
-  12700800, 12706092, 12737088, 12740000, 12754584, 12757500, 12773376,
-  12779520, 12793950, 12800000, 12830400, 12835746, 12841920, 12845056,
-  12859560, 12862500, 12899250, 12902400, 12907776, 12936000, 12939264,
-  12941390, 12960000, 12965400, 12976128, 12990780, 12993750, 13000000,
-  13002444, 13039488, 13045760, 13063680, 13097700, 13104000, 13107200,
-  13109460, 13122000, 13125000, 13162500, 13171200, 13176688, 13200000,
-  13205500, 13208832, 13226976, 13230000, 13246464, 13267800, 13271040,
-  13305600, 13311144, 13312000, 13335840, 13365000, 13377000, 13418496,
-  13436928, 13440000, 13445600, 13471920, 13475000, 13478400, 13484016,
-  13500000, 13502538, 13516800, 13522432, 13547520, 13582800, 13608000,
-  13613670, 13631488, 13646880, 13650000, 13668750, 13685760, 13698048,
-  13716864, 13720000, 13750000, 13759200, 13762560, 13778100, 13781250,
-  13798400, 13817466, 13824000, 13829760, 13856832, 13860000, 13891500,
-  13931190, 13934592, 13970880, 13977600, 13983424, 13996800, 14000000,
-  14002632, 14033250, 14040000, 14045850, 14049280, 14062500, 14080000,
-  14112000, 14117880, 14145516, 14148750, 14152320, 14155776, 14171760,
-  14175000, 14192640, 14215500, 14218750, 14224896, 14256000, 14261940,
-  14268800, 14288400, 14329224, 14332500, 14336000, 14370048, 14376960,
-  14400000, 14406000, 14417920, 14434200, 14437500, 14447160, 14450688,
-  14488320, 14515200, 14521248, 14553000, 14556672, 14560000, 14580000,
-  14598144, 14625000, 14669424, 14676480, 14680064, 14696640, 14700000,
-  14742000, 14745600, 14751744, 14762250, 14784000, 14790160, 14817600,
-  14823774, 14850000, 14859936, 14880348, 14883750, 14902272, 14909440,
-  14929920, 14968800, 14976000, 14982240, 15000000, 15002820, 15006250,
-  15052800, 15059072, 15092000, 15095808, 15116544, 15120000, 15126300,
-  15138816, 15155910, 15163200, 15169518, 15187500, 15206400, 15212736,
-  15240960, 15280650, 15288000, 15294370, 15309000, 15312500, 15335424,
-  15352740, 15356250, 15360000, 15366400, 15396480, 15400000, 15410304,
-  15431472, 15435000, 15454208, 15468750, 15479100, 15482880, 15523200,
-  15529668, 15552000, 15558480, 15588936, 15592500, 15600000, 15606500,
-  15625000, 15654912, 15676416, 15680000, 15717240, 15724800, 15728640,
-  15731352, 15746400, 15750000, 15769600, 15795000, 15805440, 15840000,
-  15846600, 15876000, 15921360, 15925000, 15925248, 15943230, 15966720,
-  15974400, 15981056, 16000000, 16003008, 16038000, 16052400, 16056320,
-  16074450, 16128000, 16134720, 16166304, 16170000, 16174080, 16200000,
-  16206750, 16220160, 16250000, 16257024, 16299360, 16307200, 16329600,
-  16336404, 16376256, 16380000, 16384000, 16402500, 16406250, 16422912,
-  16464000, 16470860, 16500000, 16503102, 16511040, 16515072, 16533720,
-  16537500, 16558080, 16584750, 16588800, 16595712, 16632000, 16638930,
-  16640000, 16669800, 16706250, 16717428, 16721250, 16765056, 16773120,
-  16777216, 16796160, 16800000, 16807000, 16839900, 16843750, 16848000,
-  16855020, 16859136, 16875000, 16896000, 16903040, 16934400, 16941456,
-  16978500, 16982784, 17006112, 17010000, 17031168, 17039360, 17058600,
-  17062500, 17107200, 17114328, 17122560, 17146080, 17150000, 17187500,
-  17199000, 17203200, 17210368, 17248000, 17252352, 17280000, 17287200,
-  17301504, 17321040, 17325000, 17336592, 17360406, 17385984, 17418240,
-  17463600, 17472000, 17479280, 17496000, 17500000, 17503290, 17550000,
-  17561600, 17600000, 17611776, 17635968, 17640000, 17647350, 17661952,
-  17690400, 17694720, 17714700, 17718750, 17740800, 17748192, 17781120,
-  17820000, 17836000, 17860500, 17891328, 17911530, 17915904, 17920000,
-  17962560, 17971200, 17978688, 18000000, 18003384, 18007500, 18022400,
-  18042750, 18058950, 18063360, 18110400, 18117946, 18144000, 18151560,
-  18187092, 18191250, 18195840, 18200000, 18225000, 18247680, 18264064,
-  18281250, 18289152, 18336780, 18345600, 18350080, 18353244, 18370800,
-  18375000, 18423288, 18427500, 18432000, 18439680, 18475776, 18480000,
-  18487700, 18522000, 18562500, 18574920, 18579456, 18627840, 18636800,
-  18662400, 18670176, 18711000, 18720000, 18727800, 18750000, 18816000,
-  18823840, 18860688, 18865000, 18869760, 18874368, 18895680, 18900000,
-  18923520, 18954000, 18966528, 19008000, 19015920, 19051200, 19059138,
-  19105632, 19110000, 19131876, 19136250, 19160064, 19169280, 19200000,
-  19208000, 19245600, 19250000, 19262880, 19267584, 19289340, 19293750,
-  19317760, 19353600, 19361664, 19404000, 19408896, 19440000, 19448100,
-  19464192, 19486170, 19500000, 19503666, 19531250, 19559232, 19568640,
-  19595520, 19600000, 19646550, 19656000, 19660800, 19664190, 19668992,
-  19683000, 19687500, 19712000, 19743750, 19756800, 19765032, 19800000,
-  19808250, 19813248, 19840464, 19845000, 19869696, 19901700, 19906250,
-  19906560, 19958400, 19966716, 19968000, 19976320, 20000000, 20003760,
-  20047500, 20065500, 20070400, 20127744, 20155392, 20160000, 20168400,
-  20185088, 20207880, 20212500, 20217600, 20226024, 20250000, 20275200,
-  20283648, 20312500, 20321280, 20374200, 20384000, 20412000, 20447232,
-  20470320, 20475000, 20480000, 20528640, 20547072, 20575296, 20580000,
-  20625000, 20638800, 20643840, 20667150, 20697600, 20706224, 20736000,
-  20744640, 20785248, 20790000, 20800000, 20837250, 20873216, 20901888,
-  20956320, 20966400, 20971520, 20975136, 20995200, 21000000, 21003948,
-  21008750, 21060000, 21073920, 21093750, 21120000, 21128800, 21168000,
-  21176820, 21218274, 21228480, 21233664, 21257640, 21262500, 21288960,
-  21299200, 21323250, 21337344, 21384000, 21392910, 21403200, 21412118,
-  21432600, 21437500, 21493836, 21498750, 21504000, 21512960, 21555072,
-  21560000, 21565440, 21600000, 21609000, 21626880, 21651300, 21656250,
-  21670740, 21676032, 21732480, 21772800, 21781872, 21829500, 21835008,
-  21840000, 21849100, 21870000, 21875000, 21897216, 21937500, 21952000,
-  22000000, 22004136, 22014720, 22020096, 22044960, 22050000, 22077440,
-  22113000, 22118400, 22127616, 22176000, 22185240, 22226400, 22275000,
-  22289904, 22295000, 22320522, 22353408, 22364160, 22394880, 22400000,
-  22453200, 22464000, 22473360, 22478848, 22500000, 22504230, 22528000,
-  22579200, 22588608, 22638000, 22643712, 22674816, 22680000, 22689450,
-  22708224, 22744800, 22750000, 22781250, 22809600, 22819104, 22830080,
-  22861440, 22932000, 22937600, 22963500, 22968750, 23003136, 23029110,
-  23040000, 23049600, 23059204, 23068672, 23094720, 23100000, 23115456,
-  23147208, 23152500, 23181312, 23218650, 23224320, 23284800, 23294502,
-  23296000, 23328000, 23337720, 23383404, 23388750, 23400000, 23409750,
-  23437500, 23482368, 23514624, 23520000, 23529800, 23575860, 23581250,
-  23587200, 23592960, 23597028, 23619600, 23625000, 23654400, 23664256,
-  23692500, 23708160, 23760000, 23769900, 23814000, 23855104, 23882040,
-  23887500, 23887872, 23950080, 23961600, 23971584, 24000000, 24004512,
-  24010000, 24057000, 24062500, 24078600, 24084480, 24147200, 24192000,
-  24202080, 24249456, 24255000, 24261120, 24300000, 24330240, 24375000,
-  24385536, 24449040, 24460800, 24470992, 24494400, 24500000, 24504606,
-  24564384, 24570000, 24576000, 24586240, 24603750, 24634368, 24640000,
-  24696000, 24706290, 24750000, 24766560, 24772608, 24800580, 24806250,
-  24837120, 24883200, 24893568, 24948000, 24960000, 24970400, 25000000,
-  25004700, 25076142, 25088000, 25147584, 25159680, 25165824, 25194240,
-  25200000, 25210500, 25231360, 25259850, 25272000, 25282530, 25288704,
-  25312500, 25344000, 25354560, 25401600, 25412184, 25467750, 25474176,
-  25480000, 25509168, 25515000, 25546752, 25559040, 25587900, 25593750,
-  25600000, 25660800, 25671492, 25683840, 25690112, 25719120, 25725000,
-  25781250, 25798500, 25804800, 25815552, 25872000, 25878528, 25882780,
-  25920000, 25930800, 25952256, 25981560, 25987500, 26000000, 26004888,
-  26078976, 26091520, 26127360, 26195400, 26208000, 26214400, 26218920,
-  26244000, 26250000, 26325000, 26342400, 26353376, 26400000, 26411000,
-  26417664, 26453952, 26460000, 26492928, 26535600, 26542080, 26572050,
-  26611200, 26622288, 26624000, 26671680, 26730000, 26754000, 26790750,
-  26836992, 26873856, 26880000, 26891200, 26943840, 26950000, 26956800,
-  26968032, 27000000, 27005076, 27011250, 27033600, 27044864, 27095040,
-  27165600, 27216000, 27227340, 27262976, 27280638, 27293760, 27300000,
-  27337500, 27343750, 27371520, 27396096, 27433728, 27440000, 27500000,
-  27505170, 27518400, 27525120, 27529866, 27556200, 27562500, 27596800,
-  27634932, 27641250, 27648000, 27659520, 27713664, 27720000, 27731550,
-  27783000, 27843750, 27862380, 27868750, 27869184, 27941760, 27955200,
-  27966848, 27993600, 28000000, 28005264, 28066500, 28080000, 28091700,
-  28098560, 28125000, 28160000, 28224000, 28235760, 28291032, 28297500,
-  28304640, 28311552, 28343520, 28350000, 28385280, 28431000, 28437500,
-  28449792, 28512000, 28523880, 28537600, 28576800, 28658448, 28665000,
-  28672000, 28697814, 28740096, 28753920, 28800000, 28812000, 28835840,
-  28868400, 28875000, 28894320, 28901376, 28934010, 28976640, 29030400,
-  29042496, 29106000, 29113344, 29120000, 29160000, 29172150, 29196288,
-  29250000, 29338848, 29352960, 29360128, 29393280, 29400000, 29412250,
-  29484000, 29491200, 29503488, 29524500, 29531250, 29568000, 29580320,
-  29635200, 29647548, 29700000, 29719872, 29760696, 29767500, 29804544,
-  29818880, 29852550, 29859840, 29937600, 29950074, 29952000, 29964480,
-  30000000, 30005640, 30012500, 30071250, 30098250, 30105600, 30118144,
-  30184000, 30191616, 30233088, 30240000, 30252600, 30277632, 30311820,
-  30318750, 30326400, 30339036, 30375000, 30412800, 30425472, 30468750,
-  30481920, 30561300, 30576000, 30588740, 30618000, 30625000, 30670848,
-  30705480, 30712500, 30720000, 30732800, 30792960, 30800000, 30820608,
-  30862944, 30870000, 30908416, 30937500, 30958200, 30965760, 31046400,
-  31059336, 31104000, 31116960, 31177872, 31185000, 31200000, 31213000,
-  31250000, 31309824, 31352832, 31360000, 31434480, 31449600, 31457280,
-  31462704, 31492800, 31500000, 31505922, 31539200, 31590000, 31610880,
-  31680000, 31693200, 31752000, 31765230, 31842720, 31850000, 31850496,
-  31886460, 31893750, 31933440, 31948800, 31962112, 32000000, 32006016,
-  32076000, 32104800, 32112640, 32148900, 32156250, 32240754, 32256000,
-  32269440, 32332608, 32340000, 32348160, 32400000, 32413500, 32440320,
-  32476950, 32500000, 32506110, 32514048, 32598720, 32614400, 32659200,
-  32672808, 32744250, 32752512, 32760000, 32768000, 32773650, 32805000,
-  32812500, 32845824, 32906250, 32928000, 32941720, 33000000, 33006204,
-  33013750, 33022080, 33030144, 33067440, 33075000, 33116160, 33169500,
-  33177600, 33191424, 33264000, 33277860, 33280000, 33339600, 33412500,
-  33434856, 33442500, 33530112, 33546240, 33554432, 33592320, 33600000,
-  33614000, 33679800, 33687500, 33696000, 33710040, 33718272, 33750000,
-  33792000, 33806080, 33868800, 33882912, 33957000, 33965568, 34012224,
-  34020000, 34062336, 34078720, 34117200, 34125000, 34214400, 34228656,
-  34245120, 34292160, 34300000, 34375000, 34398000, 34406400, 34420736,
-  34445250, 34496000, 34504704, 34560000, 34574400, 34588806, 34603008,
-  34642080, 34650000, 34673184, 34720812, 34728750, 34771968, 34836480,
-  34927200, 34944000, 34958560, 34992000, 35000000, 35006580, 35075106,
-  35100000, 35123200, 35156250, 35200000, 35223552, 35271936, 35280000,
-  35294700, 35323904, 35363790, 35380800, 35389440, 35395542, 35429400,
-  35437500, 35481600, 35496384, 35538750, 35562240, 35640000, 35654850,
-  35672000, 35721000, 35782656, 35823060, 35831250, 35831808, 35840000,
-  35925120, 35942400, 35957376, 36000000, 36006768, 36015000, 36044800,
-  36085500, 36093750, 36117900, 36126720, 36220800, 36235892, 36288000,
-  36303120, 36374184, 36382500, 36391680, 36400000, 36450000, 36495360,
-  36528128, 36562500, 36578304, 36673560, 36691200, 36700160, 36706488,
-  36741600, 36750000, 36846576, 36855000, 36864000, 36879360, 36951552,
-  36960000, 36975400, 37044000, 37125000, 37149840, 37158912, 37200870,
-  37255680, 37273600, 37324800, 37340352, 37422000, 37440000, 37455600,
-  37500000, 37507050, 37632000, 37647680, 37721376, 37730000, 37739520,
-  37748736, 37791360, 37800000, 37815750, 37847040, 37908000, 37933056,
-  37968750, 38016000, 38031840, 38102400, 38118276, 38211264, 38220000,
-  38263752, 38272500, 38281250, 38320128, 38338560, 38381850, 38400000,
-  38416000, 38491200, 38500000, 38507238, 38525760, 38535168, 38578680,
-  38587500, 38635520, 38697750, 38707200, 38723328, 38808000, 38817792,
-  38824170, 38880000, 38896200, 38928384, 38972340, 38981250, 39000000,
-  39007332, 39016250, 39062500, 39118464, 39137280, 39191040, 39200000,
-  39293100, 39312000, 39321600, 39328380, 39337984, 39366000, 39375000,
-  39424000, 39487500, 39513600, 39530064, 39600000, 39616500, 39626496,
-  39680928, 39690000, 39739392, 39803400, 39812500, 39813120, 39916800,
-  39933432, 39936000, 39952640, 40000000, 40007520, 40095000, 40131000,
-  40140800, 40255488, 40310784, 40320000, 40336800, 40370176, 40415760,
-  40425000, 40435200, 40452048, 40500000, 40507614, 40550400, 40567296,
-  40625000, 40642560, 40748400, 40768000, 40824000, 40841010, 40894464,
-  40940640, 40950000, 40960000, 41006250, 41057280, 41094144, 41150592,
-  41160000, 41177150, 41250000, 41277600, 41287680, 41334300, 41343750,
-  41395200, 41412448, 41452398, 41472000, 41489280, 41570496, 41580000,
-  41600000, 41674500, 41746432, 41793570, 41803776, 41912640, 41932800,
-  41943040, 41950272, 41990400, 42000000, 42007896, 42017500, 42099750,
-  42120000, 42137550, 42147840, 42187500, 42240000, 42257600, 42336000,
-  42353640, 42436548, 42446250, 42456960, 42467328, 42515280, 42525000,
-  42577920, 42598400, 42646500, 42656250, 42674688, 42768000, 42785820,
-  42806400, 42824236, 42865200, 42875000, 42968750, 42987672, 42997500,
-  43008000, 43025920, 43110144, 43120000, 43130880, 43200000, 43218000,
-  43253760, 43302600, 43312500, 43341480, 43352064, 43464960, 43545600,
-  43563744, 43659000, 43670016, 43680000, 43698200, 43740000, 43750000,
-  43794432, 43875000, 43904000, 44000000, 44008272, 44029440, 44040192,
-  44089920, 44100000, 44154880, 44226000, 44236800, 44255232, 44286750,
-  44352000, 44370480, 44452800, 44471322, 44550000, 44579808, 44590000,
-  44641044, 44651250, 44706816, 44728320, 44789760, 44800000, 44906400,
-  44928000, 44946720, 44957696, 45000000, 45008460, 45018750, 45056000,
-  45158400, 45177216, 45276000, 45287424, 45349632, 45360000, 45378900,
-  45416448, 45467730, 45489600, 45500000, 45508554, 45562500, 45619200,
-  45638208, 45660160, 45722880, 45841950, 45864000, 45875200, 45883110,
-  45927000, 45937500, 46006272, 46058220, 46068750, 46080000, 46099200,
-  46118408, 46137344, 46189440, 46200000, 46219250, 46230912, 46294416,
-  46305000, 46362624, 46406250, 46437300, 46448640, 46569600, 46589004,
-  46592000, 46656000, 46675440, 46766808, 46777500, 46800000, 46819500,
-  46875000, 46964736, 47029248, 47040000, 47059600, 47151720, 47162500,
-  47174400, 47185920, 47194056, 47239200, 47250000, 47308800, 47328512,
-  47385000, 47416320, 47520000, 47539800, 47628000, 47710208, 47764080,
-  47775000, 47775744, 47829690, 47900160, 47923200, 47943168, 48000000,
-  48009024, 48020000, 48114000, 48125000, 48157200, 48168960, 48223350,
-  48294400, 48384000, 48404160, 48498912, 48510000, 48522240, 48600000,
-  48620250, 48660480, 48750000, 48771072, 48898080, 48921600, 48941984,
-  48988800, 49000000, 49009212, 49128768, 49140000, 49152000, 49172480,
-  49207500, 49218750, 49268736, 49280000, 49392000, 49412580, 49500000,
-  49509306, 49533120, 49545216, 49601160, 49612500, 49674240, 49754250,
-  49766400, 49787136, 49896000, 49916790, 49920000, 49940800, 50000000,
-  50009400, 50118750, 50152284, 50163750, 50176000, 50295168, 50319360,
-  50331648, 50388480, 50400000, 50421000, 50462720, 50519700, 50531250,
-  50544000, 50565060, 50577408, 50625000, 50688000, 50709120, 50781250,
-  50803200, 50824368, 50935500, 50948352, 50960000, 51018336, 51030000,
-  51093504, 51118080, 51175800, 51187500, 51200000, 51321600, 51342984,
-  51367680, 51380224, 51438240, 51450000, 51562500, 51597000, 51609600,
-  51631104, 51744000, 51757056, 51765560, 51840000, 51861600, 51904512,
-  51963120, 51975000, 52000000, 52009776, 52081218, 52157952, 52183040,
-  52254720, 52390800, 52416000, 52428800, 52437840, 52488000, 52500000,
-  52509870, 52650000, 52684800, 52706752, 52800000, 52822000, 52835328,
-  52907904, 52920000, 52942050, 52985856, 53071200, 53084160, 53144100,
-  53156250, 53222400, 53244576, 53248000, 53343360, 53460000, 53508000,
-  53581500, 53593750, 53673984, 53734590, 53747712, 53760000, 53782400,
-  53887680, 53900000, 53913600, 53936064, 54000000, 54010152, 54022500,
-  54067200, 54089728, 54128250, 54176850, 54190080, 54331200, 54353838,
-  54432000, 54454680, 54525952, 54561276, 54573750, 54587520, 54600000,
-  54622750, 54675000, 54687500, 54743040, 54792192, 54843750, 54867456,
-  54880000, 55000000, 55010340, 55036800, 55050240, 55059732, 55112400,
-  55125000, 55193600, 55269864, 55282500, 55296000, 55319040, 55427328,
-  55440000, 55463100, 55566000, 55687500, 55724760, 55737500, 55738368,
-  55883520, 55910400, 55933696, 55987200, 56000000, 56010528, 56133000,
-  56160000, 56183400, 56197120, 56250000, 56320000, 56448000, 56471520,
-  56582064, 56595000, 56609280, 56623104, 56687040, 56700000, 56770560,
-  56862000, 56875000, 56899584, 57024000, 57047760, 57075200, 57153600,
-  57177414, 57316896, 57330000, 57344000, 57395628, 57408750, 57480192,
-  57507840, 57600000, 57624000, 57648010, 57671680, 57736800, 57750000,
-  57788640, 57802752, 57868020, 57881250, 57953280, 58060800, 58084992,
-  58212000, 58226688, 58240000, 58320000, 58344300, 58392576, 58458510,
-  58500000, 58510998, 58593750, 58677696, 58705920, 58720256, 58786560,
-  58800000, 58824500, 58939650, 58968000, 58982400, 58992570, 59006976,
-  59049000, 59062500, 59136000, 59160640, 59231250, 59270400, 59295096,
-  59400000, 59424750, 59439744, 59521392, 59535000, 59609088, 59637760,
-  59705100, 59718750, 59719680, 59875200, 59900148, 59904000, 59928960,
-  60000000, 60011280, 60025000, 60142500, 60156250, 60196500, 60211200,
-  60236288, 60368000, 60383232, 60466176, 60480000, 60505200, 60555264,
-  60623640, 60637500, 60652800, 60678072, 60750000, 60825600, 60850944,
-  60937500, 60963840, 61122600, 61152000, 61177480, 61236000, 61250000,
-  61341696, 61410960, 61425000, 61440000, 61465600, 61585920, 61600000,
-  61641216, 61725888, 61740000, 61816832, 61875000, 61916400, 61931520,
-  62001450, 62092800, 62118672, 62208000, 62233920, 62355744, 62370000,
-  62400000, 62426000, 62500000, 62511750, 62619648, 62705664, 62720000,
-  62868960, 62899200, 62914560, 62925408, 62985600, 63000000, 63011844,
-  63026250, 63078400, 63180000, 63221760, 63281250, 63360000, 63386400,
-  63504000, 63530460, 63654822, 63685440, 63700000, 63700992, 63772920,
-  63787500, 63866880, 63897600, 63924224, 63969750, 64000000, 64012032,
-  64152000, 64178730, 64209600, 64225280, 64236354, 64297800, 64312500,
-  64481508, 64496250, 64512000, 64538880, 64665216, 64680000, 64696320,
-  64706950, 64800000, 64827000, 64880640, 64953900, 64968750, 65000000,
-  65012220, 65028096, 65197440, 65228800, 65318400, 65345616, 65488500,
-  65505024, 65520000, 65536000, 65547300, 65610000, 65625000, 65691648,
-  65812500, 65856000, 65883440, 66000000, 66012408, 66027500, 66044160,
-  66060288, 66134880, 66150000, 66232320, 66339000, 66355200, 66382848,
-  66528000, 66555720, 66560000, 66679200, 66825000, 66869712, 66885000,
-  66961566, 67060224, 67092480, 67108864, 67184640, 67200000, 67228000,
-  67359600, 67375000, 67392000, 67420080, 67436544, 67500000, 67512690,
-  67584000, 67612160, 67737600, 67765824, 67914000, 67931136, 68024448,
-  68040000, 68068350, 68124672, 68157440, 68234400, 68250000, 68343750,
-  68428800, 68457312, 68490240, 68584320, 68600000, 68750000, 68796000,
-  68812800, 68841472, 68890500, 68906250, 68992000, 69009408, 69087330,
-  69120000, 69148800, 69177612, 69206016, 69284160, 69300000, 69346368,
-  69441624, 69457500, 69543936, 69655950, 69672960, 69854400, 69883506,
-  69888000, 69917120, 69984000, 70000000, 70013160, 70150212, 70166250,
-  70200000, 70229250, 70246400, 70312500, 70400000, 70447104, 70543872,
-  70560000, 70589400, 70647808, 70727580, 70743750, 70761600, 70778880,
-  70791084, 70858800, 70875000, 70963200, 70992768, 71077500, 71093750,
-  71124480, 71280000, 71309700, 71344000, 71442000, 71565312, 71646120,
-  71662500, 71663616, 71680000, 71850240, 71884800, 71914752, 72000000,
-  72013536, 72030000, 72089600, 72171000, 72187500, 72235800, 72253440,
-  72441600, 72471784, 72576000, 72606240, 72748368, 72765000, 72783360,
-  72800000, 72900000, 72990720, 73056256, 73125000, 73156608, 73347120,
-  73382400, 73400320, 73412976, 73483200, 73500000, 73513818, 73693152,
-  73710000, 73728000, 73758720, 73811250, 73903104, 73920000, 73950800,
-  74088000, 74118870, 74250000, 74299680, 74317824, 74401740, 74418750,
-  74511360, 74547200, 74649600, 74680704, 74844000, 74880000, 74911200,
-  75000000, 75014100, 75031250, 75228426, 75264000, 75295360, 75442752,
-  75460000, 75479040, 75497472, 75582720, 75600000, 75631500, 75694080,
-  75779550, 75816000, 75847590, 75866112, 75937500, 76032000, 76063680,
-  76204800, 76236552, 76403250, 76422528, 76440000, 76471850, 76527504,
-  76545000, 76562500, 76640256, 76677120, 76763700, 76781250, 76800000,
-  76832000, 76982400, 77000000, 77014476, 77051520, 77070336, 77157360,
-  77175000, 77271040, 77343750, 77395500, 77414400, 77446656, 77616000,
-  77635584, 77648340, 77760000, 77792400, 77856768, 77944680, 77962500,
-  78000000, 78014664, 78032500, 78125000, 78236928, 78274560, 78382080,
-  78400000, 78586200, 78624000, 78643200, 78656760, 78675968, 78732000,
-  78750000, 78848000, 78975000, 79027200, 79060128, 79200000, 79233000,
-  79252992, 79361856, 79380000, 79478784, 79606800, 79625000, 79626240,
-  79716150, 79833600, 79866864, 79872000, 79905280, 80000000, 80015040,
-  80190000, 80262000, 80281600, 80372250, 80510976, 80621568, 80640000,
-  80673600, 80707214, 80740352, 80831520, 80850000, 80870400, 80904096,
-  81000000, 81015228, 81033750, 81100800, 81134592, 81250000, 81285120,
-  81496800, 81536000, 81648000, 81682020, 81788928, 81841914, 81881280,
-  81900000, 81920000, 82012500, 82031250, 82114560, 82188288, 82301184,
-  82320000, 82354300, 82500000, 82515510, 82555200, 82575360, 82589598,
-  82668600, 82687500, 82790400, 82824896, 82904796, 82923750, 82944000,
-  82978560, 83140992, 83160000, 83194650, 83200000, 83349000, 83492864,
-  83531250, 83587140, 83606250, 83607552, 83825280, 83865600, 83886080,
-  83900544, 83980800, 84000000, 84015792, 84035000, 84199500, 84218750,
-  84240000, 84275100, 84295680, 84375000, 84480000, 84515200, 84672000,
-  84707280, 84873096, 84892500, 84913920, 84934656, 85030560, 85050000,
-  85155840, 85196800, 85293000, 85312500, 85349376, 85536000, 85571640,
-  85612800, 85648472, 85730400, 85750000, 85937500, 85975344, 85995000,
-  86016000, 86051840, 86093442, 86220288, 86240000, 86261760, 86400000,
-  86436000, 86507520, 86605200, 86625000, 86682960, 86704128, 86802030,
-  86929920, 87091200, 87127488, 87318000, 87340032, 87360000, 87396400,
-  87480000, 87500000, 87516450, 87588864, 87750000, 87808000, 88000000,
-  88016544, 88058880, 88080384, 88179840, 88200000, 88236750, 88309760,
-  88452000, 88473600, 88510464, 88573500, 88593750, 88704000, 88740960,
-  88905600, 88942644, 89100000, 89159616, 89180000, 89282088, 89302500,
-  89413632, 89456640, 89557650, 89579520, 89600000, 89812800, 89850222,
-  89856000, 89893440, 89915392, 90000000, 90016920, 90037500, 90112000,
-  90213750, 90294750, 90316800, 90354432, 90552000, 90574848, 90589730,
-  90699264, 90720000, 90757800, 90832896, 90935460, 90956250, 90979200,
-  91000000, 91017108, 91125000, 91238400, 91276416, 91320320, 91406250,
-  91445760, 91683900, 91728000, 91750400, 91766220, 91854000, 91875000,
-  92012544, 92116440, 92137500, 92160000, 92198400, 92236816, 92274688,
-  92378880, 92400000, 92438500, 92461824, 92588832, 92610000, 92725248,
-  92812500, 92874600, 92897280, 93139200, 93178008, 93184000, 93312000,
-  93350880, 93533616, 93555000, 93600000, 93639000, 93750000, 93929472,
-  94058496, 94080000, 94119200, 94303440, 94325000, 94348800, 94371840,
-  94388112, 94478400, 94500000, 94517766, 94617600, 94657024, 94770000,
-  94832640, 95040000, 95079600, 95256000, 95295690, 95420416, 95528160,
-  95550000, 95551488, 95659380, 95681250, 95800320, 95846400, 95886336,
-  96000000, 96018048, 96040000, 96228000, 96250000, 96314400, 96337920,
-  96446700, 96468750, 96588800, 96722262, 96768000, 96808320, 96997824,
-  97020000, 97044480, 97200000, 97240500, 97320960, 97430850, 97500000,
-  97518330, 97542144, 97656250, 97796160, 97843200, 97883968, 97977600,
-  98000000, 98018424, 98232750, 98257536, 98280000, 98304000, 98320950,
-  98344960, 98415000, 98437500, 98537472, 98560000, 98718750, 98784000,
-  98825160, 99000000, 99018612, 99041250, 99066240, 99090432, 99202320,
-  99225000, 99348480, 99508500, 99531250, 99532800, 99574272, 99792000,
-  99833580, 99840000, 99881600, 100000000, 100018800, 100237500,
-  100304568, 100327500, 100352000, 100590336, 100638720, 100663296,
-  100776960, 100800000, 100842000, 100925440, 101039400, 101062500,
-  101088000, 101130120, 101154816, 101250000, 101376000, 101418240,
-  101562500, 101606400, 101648736, 101871000, 101896704, 101920000,
-  102036672, 102060000, 102187008, 102236160, 102351600, 102375000,
-  102400000, 102643200, 102685968, 102735360, 102760448, 102876480,
-  102900000, 103125000, 103194000, 103219200, 103262208, 103335750,
-  103488000, 103514112, 103531120, 103680000, 103723200, 103766418,
-  103809024, 103926240, 103950000, 104000000, 104019552, 104162436,
-  104186250, 104315904, 104366080, 104509440, 104781600, 104832000,
-  104857600, 104875680, 104976000, 105000000, 105019740, 105043750,
-  105225318, 105300000, 105369600, 105413504, 105468750, 105600000,
-  105644000, 105670656, 105815808, 105840000, 105884100, 105971712,
-  106091370, 106142400, 106168320, 106186626, 106288200, 106312500,
-  106444800, 106489152, 106496000, 106616250, 106686720, 106920000,
-  106964550, 107016000, 107060590, 107163000, 107187500, 107347968,
-  107469180, 107493750, 107495424, 107520000, 107564800, 107775360,
-  107800000, 107827200, 107872128, 108000000, 108020304, 108045000,
-  108134400, 108179456, 108256500, 108281250, 108353700, 108380160,
-  108662400, 108707676, 108864000, 108909360, 109051904, 109122552,
-  109147500, 109175040, 109200000, 109245500, 109350000, 109375000,
-  109486080, 109584384, 109687500, 109734912, 109760000, 110000000,
-  110020680, 110073600, 110100480, 110119464, 110224800, 110250000,
-  110387200, 110539728, 110565000, 110592000, 110638080, 110854656,
-  110880000, 110926200, 111132000, 111375000, 111449520, 111475000,
-  111476736, 111602610, 111767040, 111820800, 111867392, 111974400,
-  112000000, 112021056, 112266000, 112320000, 112366800, 112394240,
-  112500000, 112521150, 112640000, 112896000, 112943040, 113164128,
-  113190000, 113218560, 113246208, 113374080, 113400000, 113447250,
-  113541120, 113724000, 113750000, 113799168, 113906250, 114048000,
-  114095520, 114150400, 114307200, 114354828, 114633792, 114660000,
-  114688000, 114791256, 114817500, 114843750, 114960384, 115015680,
-  115145550, 115200000, 115248000, 115296020, 115343360, 115473600,
-  115500000, 115521714, 115577280, 115605504, 115736040, 115762500,
-  115906560, 116093250, 116121600, 116169984, 116424000, 116453376,
-  116472510, 116480000, 116640000, 116688600, 116785152, 116917020,
-  116943750, 117000000, 117021996, 117048750, 117187500, 117355392,
-  117411840, 117440512, 117573120, 117600000, 117649000, 117879300,
-  117906250, 117936000, 117964800, 117985140, 118013952, 118098000,
-  118125000, 118272000, 118321280, 118462500, 118540800, 118590192,
-  118800000, 118849500, 118879488, 119042784, 119070000, 119218176,
-  119275520, 119410200, 119437500, 119439360, 119750400, 119800296,
-  119808000, 119857920, 120000000, 120022560, 120050000, 120285000,
-  120312500, 120393000, 120422400, 120472576, 120736000, 120766464,
-  120932352, 120960000, 121010400, 121110528, 121247280, 121275000,
-  121305600, 121356144, 121500000, 121522842, 121651200, 121701888,
-  121875000, 121927680, 122245200, 122304000, 122354960, 122472000,
-  122500000, 122523030, 122683392, 122821920, 122850000, 122880000,
-  122931200, 123018750, 123171840, 123200000, 123282432, 123451776,
-  123480000, 123531450, 123633664, 123750000, 123832800, 123863040,
-  124002900, 124031250, 124185600, 124237344, 124357194, 124416000,
-  124467840, 124711488, 124740000, 124800000, 124852000, 125000000,
-  125023500, 125239296, 125380710, 125411328, 125440000, 125737920,
-  125798400, 125829120, 125850816, 125971200, 126000000, 126023688,
-  126052500, 126156800, 126299250, 126360000, 126412650, 126443520,
-  126562500, 126720000, 126772800, 126825622, 127008000, 127060920,
-  127309644, 127338750, 127370880, 127400000, 127401984, 127545840,
-  127575000, 127733760, 127795200, 127848448, 127939500, 127968750,
-  128000000, 128024064, 128304000, 128357460, 128419200, 128450560,
-  128472708, 128595600, 128625000, 128906250, 128963016, 128992500,
-  129024000, 129077760, 129330432, 129360000, 129392640, 129413900,
-  129600000, 129654000, 129761280, 129907800, 129937500, 130000000,
-  130024440, 130056192, 130394880, 130457600, 130636800, 130691232,
-  130977000, 131010048, 131040000, 131072000, 131094600, 131220000,
-  131250000, 131383296, 131625000, 131712000, 131766880, 132000000,
-  132024816, 132055000, 132088320, 132120576, 132269760, 132300000,
-  132464640, 132678000, 132710400, 132765696, 132860250, 133056000,
-  133111440, 133120000, 133358400, 133413966, 133650000, 133739424,
-  133770000, 133923132, 133953750, 134120448, 134184960, 134217728,
-  134369280, 134400000, 134456000, 134719200, 134750000, 134784000,
-  134840160, 134873088, 135000000, 135025380, 135056250, 135168000,
-  135224320, 135475200, 135531648, 135828000, 135862272, 136048896,
-  136080000, 136136700, 136249344, 136314880, 136403190, 136468800,
-  136500000, 136525662, 136687500, 136718750, 136857600, 136914624,
-  136980480, 137168640, 137200000, 137500000, 137525850, 137592000,
-  137625600, 137649330, 137682944, 137781000, 137812500, 137984000,
-  138018816, 138174660, 138206250, 138240000, 138297600, 138355224,
-  138412032, 138568320, 138600000, 138657750, 138692736, 138883248,
-  138915000, 139087872, 139218750, 139311900, 139343750, 139345920,
-  139708800, 139767012, 139776000, 139834240, 139968000, 140000000,
-  140026320, 140300424, 140332500, 140400000, 140458500, 140492800,
-  140625000, 140800000, 140894208, 141087744, 141120000, 141178800,
-  141295616, 141455160, 141487500, 141523200, 141557760, 141582168,
-  141717600, 141750000, 141926400, 141985536, 142155000, 142187500,
-  142248960, 142560000, 142619400, 142688000, 142884000, 143130624,
-  143292240, 143325000, 143327232, 143360000, 143489070, 143700480,
-  143769600, 143829504, 144000000, 144027072, 144060000, 144179200,
-  144342000, 144375000, 144471600, 144506880, 144670050, 144883200,
-  144943568, 145152000, 145212480, 145496736, 145530000, 145566720,
-  145600000, 145800000, 145860750, 145981440, 146112512, 146250000,
-  146313216, 146694240, 146764800, 146800640, 146825952, 146966400,
-  147000000, 147027636, 147061250, 147386304, 147420000, 147456000,
-  147517440, 147622500, 147656250, 147806208, 147840000, 147901600,
-  148176000, 148237740, 148500000, 148527918, 148599360, 148635648,
-  148803480, 148837500, 149022720, 149094400, 149262750, 149299200,
-  149361408, 149688000, 149750370, 149760000, 149822400, 149884826,
-  150000000, 150028200, 150062500, 150356250, 150456852, 150491250,
-  150528000, 150590720, 150885504, 150920000, 150958080, 150994944,
-  151165440, 151200000, 151263000, 151388160, 151559100, 151593750,
-  151632000, 151695180, 151732224, 151875000, 152064000, 152127360,
-  152343750, 152409600, 152473104, 152806500, 152845056, 152880000,
-  152943700, 153055008, 153090000, 153125000, 153280512, 153354240,
-  153527400, 153562500, 153600000, 153664000, 153964800, 154000000,
-  154028952, 154103040, 154140672, 154314720, 154350000, 154542080,
-  154687500, 154791000, 154828800, 154893312, 155232000, 155271168,
-  155296680, 155520000, 155584800, 155713536, 155889360, 155925000,
-  156000000, 156029328, 156065000, 156243654, 156250000, 156473856,
-  156549120, 156764160, 156800000, 157172400, 157248000, 157286400,
-  157313520, 157351936, 157464000, 157500000, 157529610, 157696000,
-  157950000, 158054400, 158120256, 158400000, 158466000, 158505984,
-  158723712, 158760000, 158826150, 158957568, 159213600, 159250000,
-  159252480, 159432300, 159468750, 159667200, 159733728, 159744000,
-  159810560, 160000000, 160030080, 160380000, 160524000, 160563200,
-  160744500, 160781250, 161021952, 161203770, 161243136, 161280000,
-  161347200, 161414428, 161480704, 161663040, 161700000, 161740800,
-  161808192, 162000000, 162030456, 162067500, 162201600, 162269184,
-  162384750, 162500000, 162530550, 162570240, 162993600, 163061514,
-  163072000, 163296000, 163364040, 163577856, 163683828, 163721250,
-  163762560, 163800000, 163840000, 163868250, 164025000, 164062500,
-  164229120, 164376576, 164531250, 164602368, 164640000, 164708600,
-  165000000, 165031020, 165068750, 165110400, 165150720, 165179196,
-  165337200, 165375000, 165580800, 165649792, 165809592, 165847500,
-  165888000, 165957120, 166281984, 166320000, 166389300, 166400000,
-  166698000, 166985728, 167062500, 167174280, 167212500, 167215104,
-  167650560, 167731200, 167772160, 167801088, 167961600, 168000000,
-  168031584, 168070000, 168399000, 168437500, 168480000, 168550200,
-  168591360, 168750000, 168960000, 169030400, 169344000, 169414560,
-  169746192, 169785000, 169827840, 169869312, 170061120, 170100000,
-  170311680, 170393600, 170586000, 170625000, 170698752, 171072000,
-  171143280, 171225600, 171296944, 171460800, 171500000, 171532242,
-  171875000, 171950688, 171990000, 172032000, 172103680, 172186884,
-  172226250, 172440576, 172480000, 172523520, 172800000, 172872000,
-  172944030, 173015040, 173210400, 173250000, 173365920, 173408256,
-  173604060, 173643750, 173859840, 174182400, 174254976, 174636000,
-  174680064, 174720000, 174792800, 174960000, 175000000, 175032900,
-  175177728, 175375530, 175500000, 175532994, 175616000, 175781250,
-  176000000, 176033088, 176117760, 176160768, 176359680, 176400000,
-  176473500, 176619520, 176818950, 176904000, 176947200, 176977710,
-  177020928, 177147000, 177187500, 177408000, 177481920, 177693750,
-  177811200, 177885288, 178200000, 178274250, 178319232, 178360000,
-  178564176, 178605000, 178827264, 178913280, 179115300, 179156250,
-  179159040, 179200000, 179625600, 179700444, 179712000, 179786880,
-  179830784, 180000000, 180033840, 180075000, 180224000, 180427500,
-  180468750, 180589500, 180633600, 180708864, 181104000, 181149696,
-  181179460, 181398528, 181440000, 181515600, 181665792, 181870920,
-  181912500, 181958400, 182000000, 182034216, 182250000, 182476800,
-  182552832, 182640640, 182812500, 182891520, 183367800, 183456000,
-  183500800, 183532440, 183708000, 183750000, 184025088, 184232880,
-  184275000, 184320000, 184396800, 184473632, 184549376, 184757760,
-  184800000, 184877000, 184923648, 185177664, 185220000, 185450496,
-  185625000, 185749200, 185794560, 186004350, 186278400, 186356016,
-  186368000, 186624000, 186701760, 187067232, 187110000, 187200000,
-  187278000, 187500000, 187535250, 187858944, 188116992, 188160000,
-  188238400, 188606880, 188650000, 188697600, 188743680, 188776224,
-  188956800, 189000000, 189035532, 189078750, 189235200, 189314048,
-  189540000, 189665280, 189843750, 190080000, 190159200, 190512000,
-  190591380, 190840832, 190964466, 191056320, 191100000, 191102976,
-  191318760, 191362500, 191406250, 191600640, 191692800, 191772672,
-  191909250, 192000000, 192036096, 192080000, 192456000, 192500000,
-  192536190, 192628800, 192675840, 192709062, 192893400, 192937500,
-  193177600, 193444524, 193488750, 193536000, 193616640, 193995648,
-  194040000, 194088960, 194120850, 194400000, 194481000, 194641920,
-  194861700, 194906250, 195000000, 195036660, 195081250, 195084288,
-  195312500, 195592320, 195686400, 195767936, 195955200, 196000000,
-  196036848, 196465500, 196515072, 196560000, 196608000, 196641900,
-  196689920, 196830000, 196875000, 197074944, 197120000, 197437500,
-  197568000, 197650320, 198000000, 198037224, 198082500, 198132480,
-  198180864, 198404640, 198450000, 198696960, 199017000, 199062500,
-  199065600, 199148544, 199584000, 199667160, 199680000, 199763200,
-  200000000, 200037600, 200475000, 200609136, 200655000, 200704000,
-  200884698, 201180672, 201277440, 201326592, 201553920, 201600000,
-  201684000, 201850880, 202078800, 202125000, 202176000, 202260240,
-  202309632, 202500000, 202538070, 202752000, 202836480, 203125000,
-  203212800, 203297472, 203742000, 203793408, 203840000, 204073344,
-  204120000, 204205050, 204374016, 204472320, 204703200, 204750000,
-  204800000, 205031250, 205286400, 205371936, 205470720, 205520896,
-  205752960, 205800000, 205885750, 206250000, 206388000, 206438400,
-  206524416, 206671500, 206718750, 206976000, 207028224, 207062240,
-  207261990, 207360000, 207446400, 207532836, 207618048, 207852480,
-  207900000, 208000000, 208039104, 208324872, 208372500, 208631808,
-  208732160, 208967850, 209018880, 209563200, 209650518, 209664000,
-  209715200, 209751360, 209952000, 210000000, 210039480, 210087500,
-  210450636, 210498750, 210600000, 210687750, 210739200, 210827008,
-  210937500, 211200000, 211288000, 211341312, 211631616, 211680000,
-  211768200, 211943424, 212182740, 212231250, 212284800, 212336640,
-  212373252, 212576400, 212625000, 212889600, 212978304, 212992000,
-  213232500, 213281250, 213373440, 213840000, 213929100, 214032000,
-  214121180, 214326000, 214375000, 214695936, 214843750, 214938360,
-  214987500, 214990848, 215040000, 215129600, 215550720, 215600000,
-  215654400, 215744256, 216000000, 216040608, 216090000, 216268800,
-  216358912, 216513000, 216562500, 216707400, 216760320, 217324800,
-  217415352, 217728000, 217818720, 218103808, 218245104, 218295000,
-  218350080, 218400000, 218491000, 218700000, 218750000, 218972160,
-  219168768, 219375000, 219469824, 219520000, 220000000, 220041360,
-  220147200, 220200960, 220238928, 220449600, 220500000, 220541454,
-  220774400, 221079456, 221130000, 221184000, 221276160, 221433750,
-  221709312, 221760000, 221852400, 222264000, 222356610, 222750000,
-  222899040, 222950000, 222953472, 223205220, 223256250, 223534080,
-  223641600, 223734784, 223948800, 224000000, 224042112, 224532000,
-  224640000, 224733600, 224788480, 225000000, 225042300, 225093750,
-  225280000, 225685278, 225792000, 225886080, 226328256, 226380000,
-  226437120, 226492416, 226748160, 226800000, 226894500, 227082240,
-  227338650, 227448000, 227500000, 227542770, 227598336, 227812500,
-  228096000, 228191040, 228300800, 228614400, 228709656, 229209750,
-  229267584, 229320000, 229376000, 229415550, 229582512, 229635000,
-  229687500, 229920768, 230031360, 230291100, 230343750, 230400000,
-  230496000, 230592040, 230686720, 230947200, 231000000, 231043428,
-  231096250, 231154560, 231211008, 231472080, 231525000, 231813120,
-  232031250, 232186500, 232243200, 232339968, 232848000, 232906752,
-  232945020, 232960000, 233280000, 233377200, 233570304, 233834040,
-  233887500, 234000000, 234043992, 234097500, 234375000, 234710784,
-  234823680, 234881024, 235146240, 235200000, 235298000, 235758600,
-  235812500, 235872000, 235929600, 235970280, 236027904, 236196000,
-  236250000, 236544000, 236642560, 236925000, 237081600, 237180384,
-  237600000, 237699000, 237758976, 238085568, 238140000, 238436352,
-  238551040, 238820400, 238875000, 238878720, 239148450, 239500800,
-  239600592, 239616000, 239715840, 240000000, 240045120, 240100000,
-  240570000, 240625000, 240786000, 240844800, 240945152, 241116750,
-  241472000, 241532928, 241864704, 241920000, 242020800, 242121642,
-  242221056, 242494560, 242550000, 242611200, 242712288, 243000000,
-  243045684, 243101250, 243302400, 243403776, 243750000, 243855360,
-  244490400, 244608000, 244709920, 244944000, 245000000, 245046060,
-  245366784, 245525742, 245643840, 245700000, 245760000, 245862400,
-  246037500, 246093750, 246343680, 246400000, 246564864, 246903552,
-  246960000, 247062900, 247267328, 247500000, 247546530, 247665600,
-  247726080, 247768794, 248005800, 248062500, 248371200, 248474688,
-  248714388, 248771250, 248832000, 248935680, 249422976, 249480000,
-  249583950, 249600000, 249704000, 250000000, 250047000, 250478592,
-  250593750, 250761420, 250818750, 250822656, 250880000, 251475840,
-  251596800, 251658240, 251701632, 251942400, 252000000, 252047376,
-  252105000, 252313600, 252598500, 252656250, 252720000, 252825300,
-  252887040, 253125000, 253440000, 253545600, 253651244, 253906250,
-  254016000, 254121840, 254619288, 254677500, 254741760, 254800000,
-  254803968, 255091680, 255150000, 255467520, 255590400, 255696896,
-  255879000, 255937500, 256000000, 256048128, 256608000, 256714920,
-  256838400, 256901120, 256945416, 257191200, 257250000, 257812500,
-  257926032, 257985000, 258048000, 258155520, 258280326, 258660864,
-  258720000, 258785280, 258827800, 259200000, 259308000, 259522560,
-  259815600, 259875000, 260000000, 260048880, 260112384, 260406090,
-  260789760, 260915200, 261273600, 261382464, 261954000, 262020096,
-  262080000, 262144000, 262189200, 262440000, 262500000, 262549350,
-  262766592, 263250000, 263424000, 263533760, 264000000, 264049632,
-  264110000, 264176640, 264241152, 264539520, 264600000, 264710250,
-  264929280, 265356000, 265420800, 265531392, 265720500, 265781250,
-  266112000, 266222880, 266240000, 266716800, 266827932, 267300000,
-  267478848, 267540000, 267846264, 267907500, 267968750, 268240896,
-  268369920, 268435456, 268672950, 268738560, 268800000, 268912000,
-  269438400, 269500000, 269550666, 269568000, 269680320, 269746176,
-  270000000, 270050760, 270112500, 270336000, 270448640, 270641250,
-  270884250, 270950400, 271063296, 271656000, 271724544, 271769190,
-  272097792, 272160000, 272273400, 272498688, 272629760, 272806380,
-  272868750, 272937600, 273000000, 273051324, 273113750, 273375000,
-  273437500, 273715200, 273829248, 273960960, 274218750, 274337280,
-  274400000, 275000000, 275051700, 275184000, 275251200, 275298660,
-  275365888, 275562000, 275625000, 275968000, 276037632, 276349320,
-  276412500, 276480000, 276595200, 276710448, 276824064, 277136640,
-  277200000, 277315500, 277385472, 277766496, 277830000, 278175744,
-  278437500, 278623800, 278687500, 278691840, 279417600, 279534024,
-  279552000, 279668480, 279936000, 280000000, 280052640, 280600848,
-  280665000, 280800000, 280917000, 280985600, 281250000, 281600000,
-  281788416, 282175488, 282240000, 282357600, 282591232, 282910320,
-  282975000, 283046400, 283115520, 283164336, 283435200, 283500000,
-  283553298, 283852800, 283971072, 284310000, 284375000, 284497920,
-  285120000, 285238800, 285376000, 285768000, 285887070, 286261248,
-  286584480, 286650000, 286654464, 286720000, 286978140, 287043750,
-  287400960, 287539200, 287659008, 288000000, 288054144, 288120000,
-  288240050, 288358400, 288684000, 288750000, 288943200, 289013760,
-  289340100, 289406250, 289766400, 289887136, 290166786, 290304000,
-  290424960, 290993472, 291060000, 291133440, 291200000, 291600000,
-  291721500, 291962880, 292225024, 292292550, 292500000, 292554990,
-  292626432, 292968750, 293388480, 293529600, 293601280, 293651904,
-  293932800, 294000000, 294055272, 294122500, 294698250, 294772608,
-  294840000, 294912000, 294962850, 295034880, 295245000, 295312500,
-  295612416, 295680000, 295803200, 296156250, 296352000, 296475480,
-  297000000, 297055836, 297123750, 297198720, 297271296, 297606960,
-  297675000, 298045440, 298188800, 298525500, 298593750, 298598400,
-  298722816, 299376000, 299500740, 299520000, 299644800, 299769652,
-  300000000, 300056400, 300125000, 300712500, 300781250, 300913704,
-  300982500, 301056000, 301181440, 301771008, 301840000, 301916160,
-  301989888, 302330880, 302400000, 302526000, 302776320, 303118200,
-  303187500, 303264000, 303390360, 303464448, 303750000, 304128000,
-  304254720, 304687500, 304819200, 304946208, 305613000, 305690112,
-  305760000, 305887400, 306110016, 306180000, 306250000, 306561024,
-  306708480, 307054800, 307125000, 307200000, 307328000, 307929600,
-  308000000, 308057904, 308206080, 308281344, 308629440, 308700000,
-  309084160, 309375000, 309582000, 309657600, 309786624, 310007250,
-  310464000, 310542336, 310593360, 311040000, 311169600, 311299254,
-  311427072, 311778720, 311850000, 312000000, 312058656, 312130000,
-  312487308, 312500000, 312558750, 312947712, 313098240, 313528320,
-  313600000, 314344800, 314496000, 314572800, 314627040, 314703872,
-  314928000, 315000000, 315059220, 315131250, 315392000, 315675954,
-  315900000, 316108800, 316240512, 316406250, 316800000, 316932000,
-  317011968, 317447424, 317520000, 317652300, 317915136, 318274110,
-  318427200, 318500000, 318504960, 318559878, 318864600, 318937500,
-  319334400, 319467456, 319488000, 319621120, 319848750, 320000000,
-  320060160, 320760000, 320893650, 321048000, 321126400, 321181770,
-  321489000, 321562500, 322043904, 322407540, 322481250, 322486272,
-  322560000, 322694400, 322828856, 322961408, 323326080, 323400000,
-  323481600, 323534750, 323616384, 324000000, 324060912, 324135000,
-  324403200, 324538368, 324769500, 324843750, 325000000, 325061100,
-  325140480, 325987200, 326123028, 326144000, 326592000, 326728080,
-  327155712, 327367656, 327442500, 327525120, 327600000, 327680000,
-  327736500, 328050000, 328125000, 328458240, 328753152, 329062500,
-  329204736, 329280000, 329417200, 330000000, 330062040, 330137500,
-  330220800, 330301440, 330358392, 330674400, 330750000, 331161600,
-  331299584, 331619184, 331695000, 331776000, 331914240, 332563968,
-  332640000, 332778600, 332800000, 333396000, 333971456, 334125000,
-  334348560, 334425000, 334430208, 334807830, 335301120, 335462400,
-  335544320, 335602176, 335923200, 336000000, 336063168, 336140000,
-  336798000, 336875000, 336960000, 337100400, 337182720, 337500000,
-  337563450, 337920000, 338060800, 338688000, 338829120, 339492384,
-  339570000, 339655680, 339738624, 340122240, 340200000, 340341750,
-  340623360, 340787200, 341172000, 341250000, 341397504, 341718750,
-  342144000, 342286560, 342451200, 342593888, 342921600, 343000000,
-  343064484, 343750000, 343901376, 343980000, 344064000, 344207360,
-  344373768, 344452500, 344531250, 344881152, 344960000, 345047040,
-  345436650, 345600000, 345744000, 345888060, 346030080, 346420800,
-  346500000, 346565142, 346731840, 346816512, 347208120, 347287500,
-  347719680, 348279750, 348364800, 348509952, 349272000, 349360128,
-  349417530, 349440000, 349585600, 349920000, 350000000, 350065800,
-  350355456, 350751060, 350831250, 351000000, 351065988, 351146250,
-  351232000, 351562500, 352000000, 352066176, 352235520, 352321536,
-  352719360, 352800000, 352947000, 353239040, 353637900, 353718750,
-  353808000, 353894400, 353955420, 354041856, 354294000, 354375000,
-  354816000, 354963840, 355387500, 355468750, 355622400, 355770576,
-  356400000, 356548500, 356638464, 356720000, 357128352, 357210000,
-  357654528, 357826560, 358230600, 358312500, 358318080, 358400000,
-  359251200, 359400888, 359424000, 359573760, 359661568, 360000000,
-  360067680, 360150000, 360448000, 360855000, 360937500, 361179000,
-  361267200, 361417728, 362208000, 362299392, 362358920, 362797056,
-  362880000, 363031200, 363331584, 363741840, 363825000, 363916800,
-  364000000, 364068432, 364500000, 364568526, 364953600, 365105664,
-  365281280, 365625000, 365783040, 366735600, 366912000, 367001600,
-  367064880, 367416000, 367500000, 367569090, 368050176, 368465760,
-  368550000, 368640000, 368793600, 368947264, 369056250, 369098752,
-  369515520, 369600000, 369754000, 369847296, 370355328, 370440000,
-  370594350, 370900992, 371250000, 371498400, 371589120, 372008700,
-  372093750, 372556800, 372712032, 372736000, 373071582, 373248000,
-  373403520, 374134464, 374220000, 374400000, 374556000, 375000000,
-  375070500, 375156250, 375717888, 376142130, 376233984, 376320000,
-  376476800, 377213760, 377300000, 377395200, 377487360, 377552448,
-  377913600, 378000000, 378071064, 378157500, 378470400, 378628096,
-  378897750, 379080000, 379237950, 379330560, 379687500, 380160000,
-  380318400, 380476866, 381024000, 381182760, 381681664, 381928932,
-  382016250, 382112640, 382200000, 382205952, 382359250, 382637520,
-  382725000, 382812500, 383201280, 383385600, 383545344, 383818500,
-  383906250, 384000000, 384072192, 384160000, 384912000, 385000000,
-  385072380, 385257600, 385351680, 385418124, 385786800, 385875000,
-  386355200, 386718750, 386889048, 386977500, 387072000, 387233280,
-  387991296, 388080000, 388177920, 388241700, 388800000, 388962000,
-  389283840, 389723400, 389812500, 390000000, 390073320, 390162500,
-  390168576, 390625000, 391184640, 391372800, 391535872, 391910400,
-  392000000, 392073696, 392931000, 393030144, 393120000, 393216000,
-  393283800, 393379840, 393660000, 393750000, 394149888, 394240000,
-  394875000, 395136000, 395300640, 396000000, 396074448, 396165000,
-  396264960, 396361728, 396809280, 396900000, 397393920, 398034000,
-  398125000, 398131200, 398297088, 398580750, 399168000, 399334320,
-  399360000, 399526400, 400000000, 400075200, 400241898, 400950000,
-  401218272, 401310000, 401408000, 401769396, 401861250, 402361344,
-  402554880, 402653184, 403107840, 403200000, 403368000, 403536070,
-  403701760, 404157600, 404250000, 404352000, 404520480, 404619264,
-  405000000, 405076140, 405168750, 405504000, 405672960, 406250000,
-  406425600, 406594944, 407484000, 407586816, 407680000, 408146688,
-  408240000, 408410100, 408748032, 408944640, 409209570, 409406400,
-  409500000, 409576986, 409600000, 410062500, 410156250, 410572800,
-  410743872, 410941440, 411041792, 411505920, 411600000, 411771500,
-  412500000, 412577550, 412776000, 412876800, 412947990, 413048832,
-  413343000, 413437500, 413952000, 414056448, 414124480, 414523980,
-  414618750, 414720000, 414892800, 415065672, 415236096, 415704960,
-  415800000, 415973250, 416000000, 416078208, 416649744, 416745000,
-  417263616, 417464320, 417656250, 417935700, 418031250, 418037760,
-  419126400, 419301036, 419328000, 419430400, 419502720, 419904000,
-  420000000, 420078960, 420175000, 420901272, 420997500, 421093750,
-  421200000, 421375500, 421478400, 421654016, 421875000, 422400000,
-  422576000, 422682624, 423263232, 423360000, 423536400, 423886848,
-  424365480, 424462500, 424569600, 424673280, 424746504, 425152800,
-  425250000, 425779200, 425956608, 425984000, 426465000, 426562500,
-  426746880, 427680000, 427858200, 428064000, 428242360, 428652000,
-  428750000, 429391872, 429687500, 429876720, 429975000, 429981696,
-  430080000, 430259200, 430467210, 431101440, 431200000, 431308800,
-  431488512, 432000000, 432081216, 432180000, 432537600, 432717824,
-  433026000, 433125000, 433414800, 433520640, 434010150, 434649600,
-  434830704, 435456000, 435637440, 436207616, 436490208, 436590000,
-  436700160, 436800000, 436982000, 437400000, 437500000, 437582250,
-  437944320, 438337536, 438750000, 438939648, 439040000, 440000000,
-  440082720, 440294400, 440401920, 440477856, 440899200, 441000000,
-  441082908, 441183750, 441548800, 442158912, 442260000, 442368000,
-  442552320, 442867500, 442968750, 443418624, 443520000, 443704800,
-  444528000, 444713220, 445500000, 445583754, 445798080, 445900000,
-  445906944, 446410440, 446512500, 447068160, 447283200, 447469568,
-  447788250, 447897600, 448000000, 448084224, 449064000, 449251110,
-  449280000, 449467200, 449576960, 449654478, 450000000, 450084600,
-  450187500, 450560000, 451068750, 451370556, 451473750, 451584000,
-  451772160, 452656512, 452760000, 452874240, 452948650, 452984832,
-  453496320, 453600000, 453789000, 454164480, 454677300, 454781250,
-  454896000, 455000000, 455085540, 455196672, 455625000, 456192000,
-  456382080, 456601600, 457031250, 457228800, 457419312, 458419500,
-  458535168, 458640000, 458752000, 458831100, 459165024, 459270000,
-  459375000, 459841536, 460062720, 460582200, 460687500, 460800000,
-  460992000, 461184080, 461373440, 461894400, 462000000, 462086856,
-  462192500, 462309120, 462422016, 462944160, 463050000, 463626240,
-  464062500, 464373000, 464486400, 464679936, 465696000, 465813504,
-  465890040, 465920000, 466560000, 466754400, 467140608, 467668080,
-  467775000, 468000000, 468087984, 468195000, 468730962, 468750000,
-  469421568, 469647360, 469762048, 470292480, 470400000, 470596000,
-  471517200, 471625000, 471744000, 471859200, 471940560, 472055808,
-  472392000, 472500000, 472588830, 473088000, 473285120, 473850000,
-  474163200, 474360768, 475200000, 475398000, 475517952, 476171136,
-  476280000, 476478450, 476872704, 477102080, 477640800, 477750000,
-  477757440, 478296900, 478406250, 479001600, 479201184, 479232000,
-  479431680, 480000000, 480090240, 480200000, 481140000, 481250000,
-  481572000, 481689600, 481890304, 482233500, 482343750, 482944000,
-  483065856, 483611310, 483729408, 483840000, 484041600, 484243284,
-  484442112, 484989120, 485100000, 485222400, 485424576, 486000000,
-  486091368, 486202500, 486604800, 486807552, 487154250, 487500000,
-  487591650, 487710720, 488281250, 488980800, 489184542, 489216000,
-  489419840, 489888000, 490000000, 490092120, 490733568, 491051484,
-  491163750, 491287680, 491400000, 491520000, 491604750, 491724800,
-  492075000, 492187500, 492687360, 492800000, 493129728, 493593750,
-  493807104, 493920000, 494125800, 494534656, 495000000, 495093060,
-  495206250, 495331200, 495452160, 495537588, 496011600, 496125000,
-  496742400, 496949376, 497428776, 497542500, 497656250, 497664000,
-  497871360, 498845952, 498960000, 499167900, 499200000, 499408000,
-  500000000, 500094000, 500957184, 501187500, 501522840, 501637500,
-  501645312, 501760000, 502951680, 503193600, 503316480, 503403264,
-  503884800, 504000000, 504094752, 504210000, 504627200, 505197000,
-  505312500, 505440000, 505650600, 505774080, 506250000, 506880000,
-  507091200, 507302488, 507812500, 508032000, 508243680, 509238576,
-  509355000, 509483520, 509600000, 509607936, 510183360, 510300000,
-  510935040, 511180800, 511393792, 511758000, 511875000, 512000000,
-  512096256, 513216000, 513429840, 513676800, 513802240, 513890832,
-  514382400, 514500000, 514596726, 515625000, 515852064, 515970000,
-  516096000, 516311040, 516560652, 516678750, 517321728, 517440000,
-  517570560, 517655600, 518400000, 518616000, 518832090, 519045120,
-  519631200, 519750000, 520000000, 520097760, 520224768, 520812180,
-  520931250, 521579520, 521830400, 522547200, 522764928, 523908000,
-  524040192, 524160000, 524288000, 524378400, 524880000, 525000000,
-  525098700, 525218750, 525533184, 526126590, 526500000, 526598982,
-  526848000, 527067520, 527343750, 528000000, 528099264, 528220000,
-  528353280, 528482304, 529079040, 529200000, 529420500, 529858560,
-  530456850, 530712000, 530841600, 530933130, 531062784, 531441000,
-  531562500, 532224000, 532445760, 532480000, 533081250, 533433600,
-  533655864, 534600000, 534822750, 534957696, 535080000, 535302950,
-  535692528, 535815000, 535937500, 536481792, 536739840, 536870912,
-  537345900, 537468750, 537477120, 537600000, 537824000, 538876800,
-  539000000, 539101332, 539136000, 539360640, 539492352, 540000000,
-  540101520, 540225000, 540672000, 540897280, 541282500, 541406250,
-  541768500, 541900800, 542126592, 543312000, 543449088, 543538380,
-  544195584, 544320000, 544546800, 544997376, 545259520, 545612760,
-  545737500, 545875200, 546000000, 546102648, 546227500, 546750000,
-  546875000, 547430400, 547658496, 547921920, 548437500, 548674560,
-  548800000, 550000000, 550103400, 550368000, 550502400, 550597320,
-  550731776, 551124000, 551250000, 551936000, 552075264, 552698640,
-  552825000, 552960000, 553190400, 553420896, 553648128, 554273280,
-  554400000, 554631000, 554770944, 555532992, 555660000, 556351488,
-  556875000, 557247600, 557375000, 557383680, 558013050, 558835200,
-  559068048, 559104000, 559336960, 559872000, 560000000, 560105280,
-  561201696, 561330000, 561600000, 561834000, 561971200, 562500000,
-  562605750, 563200000, 563576832, 564350976, 564480000, 564715200,
-  564950498, 565182464, 565820640, 565950000, 566092800, 566231040,
-  566328672, 566870400, 567000000, 567106596, 567236250, 567705600,
-  567942144, 568620000, 568750000, 568995840, 569531250, 570240000,
-  570477600, 570752000, 571536000, 571774140, 572522496, 572893398,
-  573168960, 573300000, 573308928, 573440000, 573956280, 574087500,
-  574218750, 574801920, 575078400, 575318016, 575727750, 576000000,
-  576108288, 576240000, 576480100, 576716800, 577368000, 577500000,
-  577608570, 577886400, 578027520, 578127186, 578680200, 578812500,
-  579532800, 579774272, 580333572, 580466250, 580608000, 580849920,
-  581986944, 582120000, 582266880, 582362550, 582400000, 583200000,
-  583443000, 583925760, 584450048, 584585100, 584718750, 585000000,
-  585109980, 585243750, 585252864, 585937500, 586776960, 587059200,
-  587202560, 587303808, 587865600, 588000000, 588110544, 588245000,
-  589396500, 589531250, 589545216, 589680000, 589824000, 589925700,
-  590069760, 590490000, 590625000, 591224832, 591360000, 591606400,
-  592312500, 592704000, 592950960, 594000000, 594111672, 594247500,
-  594397440, 594542592, 595213920, 595350000, 596090880, 596377600,
-  597051000, 597187500, 597196800, 597445632, 598752000, 599001480,
-  599040000, 599289600, 599539304, 600000000, 600112800, 600250000,
-  601425000, 601562500, 601827408, 601965000, 602112000, 602362880,
-  602654094, 603542016, 603680000, 603832320, 603979776, 604661760,
-  604800000, 605052000, 605552640, 606236400, 606375000, 606528000,
-  606780720, 606928896, 607500000, 607614210, 608256000, 608509440,
-  609375000, 609638400, 609892416, 611226000, 611380224, 611520000,
-  611774800, 612220032, 612360000, 612500000, 612615150, 613122048,
-  613416960, 614109600, 614250000, 614400000, 614656000, 615093750,
-  615859200, 616000000, 616115808, 616412160, 616562688, 617258880,
-  617400000, 617657250, 618168320, 618750000, 619164000, 619315200,
-  619573248, 620014500, 620156250, 620928000, 621084672, 621186720,
-  621785970, 622080000, 622339200, 622598508, 622854144, 623557440,
-  623700000, 624000000, 624117312, 624260000, 624974616, 625000000,
-  625117500, 625895424, 626196480, 626903550, 627056640, 627200000,
-  628689600, 628951554, 628992000, 629145600, 629254080, 629407744,
-  629856000, 630000000, 630118440, 630262500, 630784000, 631351908,
-  631496250, 631800000, 632063250, 632217600, 632481024, 632812500,
-  633600000, 633864000, 634023936, 634128110, 634894848, 635040000,
-  635304600, 635830272, 636548220, 636693750, 636854400, 637000000,
-  637009920, 637119756, 637729200, 637875000, 638668800, 638934912,
-  638976000, 639242240, 639697500, 639843750, 640000000, 640120320,
-  641520000, 641787300, 642096000, 642252800, 642363540, 642978000,
-  643125000, 644087808, 644531250, 644815080, 644962500, 644972544,
-  645120000, 645388800, 645657712, 645922816, 646652160, 646800000,
-  646963200, 647069500, 647232768, 648000000, 648121824, 648270000,
-  648806400, 649076736, 649539000, 649687500, 650000000, 650122200,
-  650280960, 651974400, 652246056, 652288000, 653184000, 653456160,
-  654311424, 654735312, 654885000, 655050240, 655200000, 655360000,
-  655473000, 656100000, 656250000, 656916480, 657506304, 658125000,
-  658409472, 658560000, 658834400, 660000000, 660124080, 660275000,
-  660441600, 660602880, 660716784, 661348800, 661500000, 661624362,
-  662323200, 662599168, 663238368, 663390000, 663552000, 663828480,
-  664301250, 665127936, 665280000, 665557200, 665600000, 666792000,
-  667069830, 667942912, 668250000, 668697120, 668850000, 668860416,
-  669615660, 669768750, 670602240, 670924800, 671088640, 671204352,
-  671846400, 672000000, 672126336, 672280000, 673596000, 673750000,
-  673920000, 674200800, 674365440, 675000000, 675126900, 675281250,
-  675840000, 676121600, 677055834, 677376000, 677658240, 678984768,
-  679140000, 679311360, 679477248, 680244480, 680400000, 680683500,
-  681246720, 681574400, 682015950, 682344000, 682500000, 682628310,
-  682795008, 683437500, 683593750, 684288000, 684573120, 684902400,
-  685187776, 685843200, 686000000, 686128968, 687500000, 687629250,
-  687802752, 687960000, 688128000, 688246650, 688414720, 688747536,
-  688905000, 689062500, 689762304, 689920000, 690094080, 690873300,
-  691031250, 691200000, 691488000, 691776120, 692060160, 692841600,
-  693000000, 693130284, 693288750, 693463680, 693633024, 694416240,
-  694575000, 695439360, 696093750, 696559500, 696718750, 696729600,
-  697019904, 698544000, 698720256, 698835060, 698880000, 699171200,
-  699840000, 700000000, 700131600, 700710912, 701502120, 701662500,
-  702000000, 702131976, 702292500, 702464000, 703125000, 704000000,
-  704132352, 704471040, 704643072, 705438720, 705600000, 705894000,
-  706478080, 707275800, 707437500, 707616000, 707788800, 707910840,
-  708083712, 708588000, 708750000, 709632000, 709927680, 710775000,
-  710937500, 711244800, 711541152, 712800000, 713097000, 713276928,
-  713440000, 714256704, 714420000, 715309056, 715653120, 716461200,
-  716625000, 716636160, 716800000, 717445350, 718502400, 718801776,
-  718848000, 719147520, 719323136, 720000000, 720135360, 720300000,
-  720896000, 721710000, 721875000, 722358000, 722534400, 722835456,
-  723350250, 724416000, 724598784, 724717840, 725594112, 725760000,
-  726062400, 726364926, 726663168, 727483680, 727650000, 727833600,
-  728000000, 728136864, 729000000, 729137052, 729303750, 729907200,
-  730211328, 730562560, 731250000, 731566080, 733471200, 733824000,
-  734003200, 734129760, 734832000, 735000000, 735138180, 735306250,
-  736100352, 736577226, 736931520, 737100000, 737280000, 737587200,
-  737894528, 738112500, 738197504, 738281250, 739031040, 739200000,
-  739508000, 739694592, 740710656, 740880000, 741188700, 741801984,
-  742500000, 742639590, 742996800, 743178240, 743306382, 744017400,
-  744187500, 745113600, 745424064, 745472000, 746143164, 746313750,
-  746496000, 746807040, 748268928, 748440000, 748751850, 748800000,
-  749112000, 749424130, 750000000, 750141000, 750312500, 751435776,
-  751781250, 752284260, 752456250, 752467968, 752640000, 752953600,
-  754427520, 754600000, 754790400, 754974720, 755104896, 755827200,
-  756000000, 756142128, 756315000, 756940800, 757256192, 757795500,
-  757968750, 758160000, 758475900, 758661120, 759375000, 760320000,
-  760636800, 760953732, 761718750, 762048000, 762365520, 763363328,
-  763857864, 764032500, 764225280, 764400000, 764411904, 764718500,
-  765275040, 765450000, 765625000, 766402560, 766771200, 767090688,
-  767637000, 767812500, 768000000, 768144384, 768320000, 769824000,
-  770000000, 770144760, 770515200, 770703360, 770836248, 771573600,
-  771750000, 772710400, 773437500, 773778096, 773955000, 774144000,
-  774466560, 774840978, 775982592, 776160000, 776355840, 776483400,
-  777600000, 777924000, 778567680, 779446800, 779625000, 780000000,
-  780146640, 780325000, 780337152, 781218270, 781250000, 782369280,
-  782745600, 783071744, 783820800, 784000000, 784147392, 785862000,
-  786060288, 786240000, 786432000, 786567600, 786759680, 787320000,
-  787500000, 787648050, 788299776, 788480000, 789750000, 790272000,
-  790601280, 792000000, 792148896, 792330000, 792529920, 792723456,
-  793618560, 793800000, 794130750, 794787840, 796068000, 796250000,
-  796262400, 796594176, 797161500, 797343750, 798336000, 798668640,
-  798720000, 799052800, 800000000, 800150400, 800483796, 801900000,
-  802436544, 802620000, 802816000, 803538792, 803722500, 803906250,
-  804722688, 805109760, 805306368, 806018850, 806215680, 806400000,
-  806736000, 807072140, 807403520, 808315200, 808500000, 808651998,
-  808704000, 809040960, 809238528, 810000000, 810152280, 810337500,
-  811008000, 811345920, 811923750, 812500000, 812652750, 812851200,
-  813189888, 814968000, 815173632, 815307570, 815360000, 816293376,
-  816480000, 816820200, 817496064, 817889280, 818419140, 818606250,
-  818812800, 819000000, 819153972, 819200000, 819341250, 820125000,
-  820312500, 821145600, 821487744, 821882880, 822083584, 822656250,
-  823011840, 823200000, 823543000, 825000000, 825155100, 825343750,
-  825552000, 825753600, 825895980, 826097664, 826686000, 826875000,
-  827904000, 828112896, 828248960, 829047960, 829237500, 829440000,
-  829785600, 830131344, 830472192, 831409920, 831600000, 831946500,
-  832000000, 832156416, 833299488, 833490000, 834527232, 834928640,
-  835312500, 835871400, 836062500, 836075520, 838252800, 838602072,
-  838656000, 838860800, 839005440, 839808000, 840000000, 840157920,
-  840350000, 841802544, 841995000, 842187500, 842400000, 842751000,
-  842956800, 843308032, 843750000, 844800000, 845152000, 845365248,
-  846526464, 846720000, 847072800, 847773696, 848730960, 848925000,
-  849139200, 849346560, 849493008, 850305600, 850500000, 850659894,
-  851558400, 851913216, 851968000, 852930000, 853125000, 853493760,
-  855360000, 855716400, 856128000, 856484720, 857304000, 857500000,
-  857661210, 858783744, 859375000, 859753440, 859950000, 859963392,
-  860160000, 860518400, 860934420, 861131250, 862202880, 862400000,
-  862617600, 862977024, 864000000, 864162432, 864360000, 864720150,
-  865075200, 865435648, 866052000, 866250000, 866829600, 867041280,
-  868020300, 868218750, 869299200, 869661408, 870500358, 870912000,
-  871274880, 872415232, 872980416, 873180000, 873400320, 873600000,
-  873964000, 874800000, 875000000, 875164500, 875888640, 876675072,
-  876877650, 877500000, 877664970, 877879296, 878080000, 878906250,
-  880000000, 880165440, 880588800, 880803840, 880955712, 881798400,
-  882000000, 882165816, 882367500, 883097600, 884094750, 884317824,
-  884520000, 884736000, 884888550, 885104640, 885735000, 885937500,
-  886837248, 887040000, 887409600, 887779354, 888468750, 889056000,
-  889426440, 891000000, 891167508, 891371250, 891596160, 891800000,
-  891813888, 892820880, 893025000, 894136320, 894566400, 894939136,
-  895576500, 895781250, 895795200, 896000000, 896168448, 898128000,
-  898502220, 898560000, 898934400, 899153920, 899308956, 900000000,
-  900169200, 900375000, 901120000, 902137500, 902343750, 902741112,
-  902947500, 903168000, 903544320, 905313024, 905520000, 905748480,
-  905897300, 905969664, 906992640, 907200000, 907578000, 908328960,
-  909354600, 909562500, 909792000, 910000000, 910171080, 910393344,
-  911250000, 912384000, 912764160, 913203200, 914062500, 914457600,
-  914838624, 916839000, 917070336, 917280000, 917504000, 917662200,
-  918330048, 918540000, 918750000, 919683072, 920125440, 921164400,
-  921375000, 921600000, 921984000, 922368160, 922746880, 923788800,
-  924000000, 924173712, 924385000, 924618240, 924844032, 925888320,
-  926100000, 927252480, 928125000, 928746000, 928972800, 929359872,
-  930021750, 931392000, 931627008, 931780080, 931840000, 933120000,
-  933508800, 933897762, 934281216, 935336160, 935550000, 936000000,
-  936175968, 936390000, 937461924, 937500000, 937676250, 938843136,
-  939294720, 939524096, 940584960, 940800000, 941192000, 943034400,
-  943250000, 943488000, 943718400, 943881120, 944111616, 944784000,
-  945000000, 945177660, 945393750, 946176000, 946570240, 947027862,
-  947700000, 948326400, 948721536, 949218750, 950400000, 950796000,
-  951035904, 952342272, 952560000, 952956900, 953745408, 954204160,
-  954822330, 955281600, 955500000, 955514880, 955679634, 956593800,
-  956812500, 957031250, 958003200, 958402368, 958464000, 958863360,
-  959546250, 960000000, 960180480, 960400000, 962280000, 962500000,
-  962680950, 963144000, 963379200, 963545310, 963780608, 964467000,
-  964687500, 965888000, 966131712, 967222620, 967443750, 967458816,
-  967680000, 968083200, 968486568, 968884224, 969978240, 970200000,
-  970444800, 970604250, 970849152, 972000000, 972182736, 972405000,
-  973209600, 973615104, 974308500, 974531250, 975000000, 975183300,
-  975406250, 975421440, 976562500, 977961600, 978369084, 978432000,
-  978839680, 979776000, 980000000, 980184240, 981467136, 982102968,
-  982327500, 982575360, 982800000, 983040000, 983209500, 983449600,
-  984150000, 984375000, 985374720, 985600000, 986259456, 987187500,
-  987614208, 987840000, 988251600, 989069312, 990000000, 990186120,
-  990412500, 990662400, 990904320, 991075176, 992023200, 992250000,
-  993484800, 993898752, 994857552, 995085000, 995312500, 995328000,
-  995742720, 997691904, 997920000, 998335800, 998400000, 998816000,
-  1000000000, 1000188000, 1001914368, 1002375000, 1003045680, 1003275000,
-  1003290624, 1003520000, 1004423490, 1005903360, 1006387200, 1006632960,
-  1006806528, 1007769600, 1008000000, 1008189504, 1008420000, 1009254400,
-  1010394000, 1010625000, 1010880000, 1011301200, 1011548160, 1012500000,
-  1012690350, 1013760000, 1014182400, 1014604976, 1015625000, 1016064000,
-  1016487360, 1018477152, 1018710000, 1018967040, 1019200000, 1019215872,
-  1020366720, 1020600000, 1021025250, 1021870080, 1022361600, 1022787584,
-  1023516000, 1023750000, 1024000000, 1024192512, 1025156250, 1026432000,
-  1026859680, 1027353600, 1027604480, 1027781664, 1028764800, 1029000000,
-  1029193452, 1029428750, 1031250000, 1031704128, 1031940000, 1032192000,
-  1032622080, 1033121304, 1033357500, 1033593750, 1034643456, 1034880000,
-  1035141120, 1035311200, 1036309950, 1036800000, 1037232000, 1037664180,
-  1038090240, 1039262400, 1039500000, 1039695426, 1040000000, 1040195520,
-  1040449536, 1041624360, 1041862500, 1043159040, 1043660800, 1044839250,
-  1045094400, 1045529856, 1047816000, 1048080384, 1048252590, 1048320000,
-  1048576000, 1048756800, 1049193782, 1049760000, 1050000000, 1050197400,
-  1050437500, 1051066368, 1052253180, 1052493750, 1053000000, 1053197964,
-  1053438750, 1053696000, 1054135040, 1054687500, 1056000000, 1056198528,
-  1056440000, 1056706560, 1056964608, 1058158080, 1058400000, 1058841000,
-  1059717120, 1060913700, 1061156250, 1061424000, 1061683200, 1061866260,
-  1062125568, 1062882000, 1063125000, 1064448000, 1064891520, 1064960000,
-  1066162500, 1066406250, 1066867200, 1067311728, 1069200000, 1069645500,
-  1069915392, 1070160000, 1070605900, 1071385056, 1071630000, 1071875000,
-  1072963584, 1073479680, 1073741824
-};
-static const int ngoodn = sizeof (goodn) / sizeof (int);
+    The odd parts 3^b 5^c 7^d m up to n are enumerated, each is multiplied
+    by the power of 2 that brings it closest to n from below or above. This
+    gives the same lengths as the former table up to 2^30 and works for any
+    64-bit n.
+
+    round_smooth() gives the nearest 7-smooth length 2^a 3^b 5^c 7^d, odd
+    ones included, for the grid mode of LPSD.
+ ********************************************************************************/
+#include <limits.h>
+#include <stdlib.h>
+#include "goodn.h"
 
+/*
+	largest good length <= n if up is 0, smallest good length >= n if
+	up is 1, for n >= 2
+*/
+static long long
+good_near (long long n, int up)
+{
+  static const int mlist[] = { 1, 11, 13 };
+  long long best = up ? LLONG_MAX : 2;
+  long long p3, p5, v, w;
+  int i;
 
-int round_down (int n) {
-	int *ip = goodn;
+  for (i = 0; i < 3; i++)
+    for (p3 = mlist[i]; p3 <= n; p3 *= 3)
+      for (p5 = p3; p5 <= n; p5 *= 5)
+	for (v = p5; v <= n; v *= 7)
+	  {
+	    w = 2 * v;
+	    if (up)
+	      {
+		while (w < n)
+		  w *= 2;
+		if (w < best)
+		  best = w;
+	      }
+	    else if (w <= n)
+	      {
+		while (w <= n / 2)
+		  w *= 2;
+		if (w > best)
+		  best = w;
+	      }
+	  }
+  return best;
+}
 
+long long round_down (long long n) {
 	if (n < 2) return 2;
-	if (n >= goodn[ngoodn - 1]) return n;
-	while (*ip < n) ++ip;
-	if (*ip > n) --ip;
-  	return *ip;
+	return good_near (n, 0);
 }
 
-int round_close (int n, int nmax) {
-	int *ip = goodn, i1, i2;
+long long round_close (long long n, long long nmax) {
+	long long i1, i2;
 
 	if (n < 2) return 2;
-	if (n >= goodn[ngoodn - 1]) return n;
-	while (*ip < n) ++ip;
-	i2 = *(ip--);
-	i1 = *ip;
+	i1 = good_near (n, 0);
+	i2 = good_near (n, 1);
 	if (((n - i1) <= (i2 - n)) || i2 > nmax) return i1;
 	return i2;
 }
+
+/* nearest 7-smooth length 2^a 3^b 5^c 7^d to n that is at most nmax */
+long long round_smooth (long long n, long long nmax) {
+	long long best = 1, p3, p5, v, w;
+
+	if (n < 2) return (nmax < 2) ? nmax : 2;
+	for (p3 = 1; p3 <= 2 * n; p3 *= 3)
+		for (p5 = p3; p5 <= 2 * n; p5 *= 5)
+			for (v = p5; v <= 2 * n; v *= 7) {
+				/* the powers of 2 times v just below and above n */
+				for (w = v; 2 * w <= n; w *= 2);
+				if (w <= nmax && llabs (w - n) < llabs (best - n))
+					best = w;
+				if (w < n && 2 * w <= nmax && llabs (2 * w - n) < llabs (best - n))
+					best = 2 * w;
+			}
+	return best;
+}
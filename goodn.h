@@ -1,7 +1,8 @@
 #ifndef __goodn_h
 #define __goodn_h
 
-int round_down (int n);
-int round_close (int n, int nmax) ;
+long long round_down (long long n);
+long long round_close (long long n, long long nmax) ;
+long long round_smooth (long long n, long long nmax);
 
 #endif
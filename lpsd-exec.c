@@ -8,7 +8,6 @@
     transforms at frequencies equally spaced on a logarithmic axis
 
  ********************************************************************************/
-#define SINCOS
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -71,6 +70,8 @@ void getUserInput()
 		asks("Input file", cfg.ifn);
 	if (!exists(cfg.ifn))
 		gerror("Input file name does not exist");
+	if (strcmp(cfg.ifn, "-") == 0)
+		gerror("Input from stdin needs option -d, the questions are read from there");
 
 	if (cfg.asktime == 1)
 		aski("Time in column 1 (0 : no, 1 : yes)?", &cfg.time);
@@ -97,13 +98,16 @@ void getUserInput()
 	if (cfg.askgfn == 1)
 		asks("Gnuplot file", cfg.gfn);
 
-	data.NoC = getNoC(cfg.ifn, &data.comma);
-	if (data.NoC == -1)
-		gerror("File type not recognized!");
+	if (strcmp(cfg.ifmt, "text") == 0) {
+		data.NoC = getNoC(cfg.ifn, &data.comma);
+		if (data.NoC == -1)
+			gerror("File type not recognized!");
+	}
 		
 	/* read length of data file and mean data value */
-	printf("Counting data, calculating mean...\n");
-	probe_file(cfg.ifn, &fsamp, &data.ndata, &data.mean, cfg.time, cfg.colA, cfg.colB, data.comma);
+	printf("Reading data, calculating mean...\n");
+	probe_file(&cfg, &fsamp, &data.ndata, &data.mean, data.comma);
+	data.blockmean = cfg.submean && block_read();
 	/*
 		if time is contained in first column and sampling frequency is not given on command line
 		then use sampling frequency determined from first column in file
@@ -151,7 +155,7 @@ void getUserInput()
 	if ((cfg.cmdovlp==0) && (cfg.ovlp<0)) cfg.ovlp=rov;
 	
 	if (cfg.askMETHOD == 1)
-		aski("METHOD for frequency nodes calculation (0 or 1)", &cfg.METHOD);
+		aski("METHOD for frequency nodes calculation (0, 1 or 2)", &cfg.METHOD);
 	
 	if (cfg.fmin < 0) {
 		xov = (1. - cfg.ovlp / 100.);
@@ -178,7 +182,7 @@ void getUserInput()
 			aski("Minimum number of averages", &cfg.minAVG);	
 		if (cfg.askdesAVG == 1)
 			aski("Desired number of averages", &cfg.desAVG);
-	} else if (cfg.METHOD == 1) {
+	} else if (cfg.METHOD == 1 || cfg.METHOD == 2) {
 		if (cfg.fres < 0) {
 			cfg.nfft=round_down(data.nread);
 			cfg.fres = cfg.fsamp / (double) cfg.nfft;
@@ -187,7 +191,10 @@ void getUserInput()
 			askd("Frequency resolution", &cfg.fres);
 		cfg.nfft=round_down(cfg.fsamp/cfg.fres);	/* suitable nfft for FFTW */
 		cfg.fres = cfg.fsamp / (double) cfg.nfft;	
-		cfg.nspec = cfg.fmax/cfg.fres+1-dMax(cfg.sbin,cfg.fmin/cfg.fres);
+		if (cfg.METHOD == 1)
+			cfg.nspec = cfg.fmax/cfg.fres+1-dMax(cfg.sbin,cfg.fmin/cfg.fres);
+		else if (cfg.asknspec == 1)
+			aski("Number of bands in spectrum", &cfg.nspec);
 	}
 	if (cfg.askulsb == 1)
 		askd("Scaling factor", &cfg.ulsb);
@@ -212,16 +219,22 @@ void getDefaultValues()
 
 	if (!exists(cfg.ifn))
 	    gerror("input file name does not exist");
+	/* a pipe is read once, its length and time column are not known before */
+	if (is_stream(cfg.ifn) && (cfg.time == 0) && (cfg.askfsamp == 1) && (cfg.cmdfsamp == 0))
+	    gerror("Input from stdin or a pipe needs the sampling frequency, option -f or FSAMP");
 	/* handle output filename */
 	parse_fgsC(cfg.ofn,cfg.ifn,cfg.param,cfg.colA,cfg.colB);
 	parse_fgsC(cfg.gfn,cfg.ifn,cfg.param,cfg.colA,cfg.colB);
 	parse_op(cfg.gfn,cfg.ofn);
-	data.NoC = getNoC(cfg.ifn, &data.comma);
-	if (data.NoC == -1)
-	    gerror("File type not recognized!");
+	if (strcmp(cfg.ifmt, "text") == 0) {
+	    data.NoC = getNoC(cfg.ifn, &data.comma);
+	    if (data.NoC == -1)
+		gerror("File type not recognized!");
+	}
 	/* read length of data file and mean data value */
-	printf("Counting data, calculating mean...\n");
-	probe_file(cfg.ifn, &fsamp, &data.ndata, &data.mean, cfg.time, cfg.colA, cfg.colB, data.comma);
+	printf("Reading data, calculating mean...\n");
+	probe_file(&cfg, &fsamp, &data.ndata, &data.mean, data.comma);
+	data.blockmean = cfg.submean && block_read();
 	/*
 		if time is contained in first column and sampling frequency is not given on command line
 		then use sampling frequency determined from first column in file
@@ -249,23 +262,23 @@ void getDefaultValues()
 		if (cfg.METHOD == 0) {
 			xov = (1. - cfg.ovlp / 100.);
 			cfg.fres = 1. / (cfg.tmax - cfg.tmin) * (1 + xov * (cfg.minAVG - 1));
-		} else if (cfg.METHOD == 1) {
+		} else if (cfg.METHOD == 1 || cfg.METHOD == 2) {
 			cfg.nfft=round_down(data.nread);
 			cfg.fres = cfg.fsamp / (double) cfg.nfft;
 		}
 	}    
 	if (cfg.fmax < 0)
 	    cfg.fmax = cfg.fsamp / 2.0;
-	if (cfg.METHOD == 1) {
+	if (cfg.METHOD == 1 || cfg.METHOD == 2)
 		cfg.nfft = cfg.fsamp / cfg.fres;
+	if (cfg.METHOD == 1)
 		cfg.nspec = cfg.fmax/cfg.fres+1-dMax(cfg.sbin,cfg.fmin/cfg.fres);
-	}
 }
 
 /* for debugging */
-double calculate_mean(double *segm, int nfft)
+double calculate_mean(double *segm, long long nfft)
 {
-	int i;
+	long long i;
 	double m = 0;
 
 	for (i = 0; i < nfft; i++) {
@@ -282,12 +295,14 @@ void memalloc(tCFG * cfg, tDATA * data)
 	(*data).varpsd = (double *) xmalloc(((*cfg).nspec) * sizeof(double));
 	(*data).fspec = (double *) xmalloc(((*cfg).nspec) * sizeof(double));
 	(*data).bins = (double *) xmalloc(((*cfg).nspec) * sizeof(double));
-	(*data).nffts = (int *) xmalloc(((*cfg).nspec) * sizeof(int));
-	(*data).avg = (int *) xmalloc(((*cfg).nspec) * sizeof(int));
+	(*data).nffts = (long long *) xmalloc(((*cfg).nspec) * sizeof(long long));
+	(*data).avg = (long long *) xmalloc(((*cfg).nspec) * sizeof(long long));
 	if ((*cfg).METHOD == 1) {
 		(*data).fft_ps = (double *) xmalloc(((*cfg).nfft) * sizeof(double));
 		(*data).fft_varps = (double *) xmalloc(((*cfg).nfft) * sizeof(double));	
 	}
+	if ((*cfg).METHOD == 2)
+		(*data).rbw = (double *) xmalloc(((*cfg).nspec) * sizeof(double));
 }
 
 void memfree(tCFG *cfg, tDATA * data)
@@ -304,6 +319,8 @@ void memfree(tCFG *cfg, tDATA * data)
 		xfree((*data).fft_ps);
 		xfree((*data).fft_varps);
 	}
+	if ((*cfg).METHOD == 2)
+		xfree((*data).rbw);
 	close_file();
 }
 
@@ -313,6 +330,8 @@ void checkParams() {
 	xov = (1. - cfg.ovlp / 100.);
 	fm = cfg.sbin / (data.nread/cfg.fsamp) * (1 + xov * (cfg.minAVG - 1));
 
+	if ((cfg.METHOD<0) || (cfg.METHOD>2))
+		gerror("METHOD must be 0, 1 or 2!");
 	if (cfg.fmax>cfg.fsamp/2.0)
 		gerror("Largest frequency cannot be bigger than fsamp/2!");
 	if ((cfg.fmin*(1.+1e-6))<fm) {
@@ -322,7 +341,7 @@ void checkParams() {
 	if (cfg.METHOD==0) {
 		if (cfg.cmdfres) message("frequency resolution parameter is ignored in LPSD mode!");
 	}
-	if (cfg.METHOD==1) {
+	if ((cfg.METHOD==1) || (cfg.METHOD==2)) {
 		if (cfg.cmdminAVG) message("minimum averages parameter is ignored in FFT mode!");
 		if (cfg.cmddesAVG) message("desired averages parameter is ignored in FFT mode!");
 	}
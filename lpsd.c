@@ -9,8 +9,24 @@
     
     lpsd does everything except user interface and data output
  *****************************************************************************/
-#define SINCOS
 #define FAST 1
+#define TFBLOCK 4096		/* block length of the table-free kernel getDFT3() */
+#define FFTBATCH 1.0		/* a run of n bins with equal nfft is computed by FFT
+				   if n > FFTBATCH * log2(nfft) */
+#define SDFTCOST 6.0		/* cost of the sliding DFT per sample and frequency */
+#define SDFTSEG 200.0		/* and per segment and frequency, both relative to
+				   one term of the direct DFT */
+#define DECMINNFFT 1024		/* smallest nfft of a bin on a decimated level */
+#define PLANCALIB 32768		/* small nfft of the kernel timing in print_plan() */
+#define PLANCALIBBIG 1048576	/* large nfft of the kernel timing */
+#define PLANCALIBSEG 16		/* on this many times nfft samples */
+#define PLANCALIBT 0.01		/* for at least this many seconds */
+#define PLANCALIBREP 3		/* the fastest of this many timings counts */
+#define OOCMINBLOCK 65536	/* smallest block of samples in out-of-core mode */
+#define WELCHBATCH 16		/* segments per batched FFT of calculate_fftw() */
+#define WELCHMEM 8388608.	/* and at most this many bytes of them */
+#define GROUPMEM 8388608.	/* bytes of the tables of a group task */
+#define GROUPGAIN 0.9		/* cost of a bin in a group relative to getDFT2() */
 
 
 #include <stdlib.h>
@@ -28,6 +44,15 @@
 #include "lpsd.h"
 #include "misc.h"
 #include "errors.h"
+#include "workpool.h"
+#include "dftkern.h"
+#include "detrend.h"
+#include "wincache.h"
+#include "phasor.h"
+#include "sdft.h"
+#include "decimate.h"
+#include "fftplan.h"
+#include "goodn.h"
 
 #define MAX(a,b)             \
 ({                           \
@@ -83,13 +108,96 @@ int round (double x) {
 #endif
 
 /********************************************************************************
- * 	global variables						   	
+ * 	types								   	
  ********************************************************************************/
-static int nread;
-static double winsum;
-static double winsum2;
-static double nenbw;		/* normalized equivalent noise bandwidth */
-static double *dwin;		/* pointer to window function for FFT */
+typedef struct
+{
+  int first;			/* first bin */
+  int count;			/* number of bins, > 1 for a run or a group */
+  int level;			/* decimation level of a single bin or a group */
+  int kern;			/* kernel, index into kernels[] */
+  long long nfft;		/* nfft on the decimation level */
+  long long nseg;		/* number of segments */
+  double cost;			/* estimated cost, see tKERNEL */
+} tBINRUN;			/* one task of the frequency loop */
+
+typedef struct
+{
+  tCFG *cfg;
+  tDATA *data;
+  const tDTIDX *dt;		/* time series and its detrend index */
+  tPYRAMID *pyr;		/* decimated time series, or NULL */
+  const tBINRUN *run;		/* tasks */
+  double cw[MAXCOS];		/* cosine-sum coefficients of the window */
+  int ncos;			/* their number, 0 if not a cosine sum */
+} tLPSDJOB;			/* shared, read-only state of the frequency loop */
+
+typedef struct
+{
+  const char *name;
+  int multi;			/* 0: one bin, 1: a run of bins with equal nfft
+				   stepping by 1, 2: a group of bins with equal
+				   nfft on one decimation level */
+  double (*cost) (const tLPSDJOB * job, long long nfft, long long nseg,
+		  int nb);	/* in terms of the direct DFT, < 0 not usable */
+  void (*run) (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+	       double fsamp);
+} tKERNEL;			/* entry of the kernel registry */
+
+typedef struct
+{
+  long long nfft[2];		/* small and large nfft of the timing */
+  double tterm[2];		/* seconds per term of the direct DFT there */
+  double ttab;			/* seconds per value of the tables of a bin */
+} tCALIB;			/* time model of print_plan() */
+
+typedef struct
+{
+  const tDTIDX *dt;		/* time series and its detrend index */
+  const double *dwin;		/* window values */
+  long long nfft;
+  long long segOffset;		/* distance of the segment starts */
+  long long nseg;		/* number of segments */
+  int ntask;			/* number of tasks, ranges of segments */
+  int batch;			/* segments per batched FFT */
+  int LR;
+  const tFFTPLAN *plan;		/* r2c FFT of batch segments */
+  const tFFTPLAN *plan1;	/* r2c FFT of one segment, any alignment */
+  int nband;			/* METHOD 2: number of bands, 0: every bin */
+  const long long *k0;		/* band j holds the bins k0[j] <= k < k0[j+1] */
+  long long nacc;		/* accumulators per task, nfft/2+1 or nband */
+  double *m, *t;		/* West's mean and sum of squares, nacc per task */
+  long long *n;			/* number of segments of every task */
+} tWELCHJOB;			/* state of the batched Welch engine calculate_fftw() */
+
+typedef struct
+{
+  long long nfft;		/* segment length */
+  double bin;			/* frequency in bins */
+  long long segOffset, nseg;	/* distance and number of segments */
+  long long next;		/* first segment not averaged yet */
+  long long ninit;		/* number of segments started */
+  long long nopen;		/* length of the ring of open segments */
+  double *re, *im;		/* partial DFTs of the open segments */
+  tDD *sy, *sty;		/* their partial regression sums, LR == 1 */
+  double *xa, *xb;		/* their first and last value, LR == 2 */
+  long double w0re, w0im, w1re, w1im;	/* DFT of window and window times index */
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  double west_m, west_t;	/* West's running mean and sum of squares */
+  double west_b, west_tpb, west_tbb;	/* mean of b = Re(X*conj(V)), co-moments
+					   of |X|^2 and b, blockmean only */
+  long long nsum;		/* number of segments averaged */
+} tOOCBIN;			/* one bin while the time series streams by */
+
+typedef struct
+{
+  tCFG *cfg;
+  tOOCBIN *bin;			/* all bins */
+  const double *x;		/* current block of the time series */
+  const tDTIDX *dt;		/* its detrend index if LR == 1 */
+  long long b0, nb;		/* index of its first sample, its length */
+  int blockmean;		/* 1: the mean is taken while the blocks are read */
+} tOOCJOB;			/* shared state of one block in out-of-core mode */
 
 /********************************************************************************
  * 	functions								
@@ -132,94 +240,48 @@ ExpMinusOne(double x)
 }
 
 /* 
-	copies nfft values from data to segm
-	if drift removal is selected, a linear regression of data is 
-	performed and the subtracted values are copied to segm
+	copies nfft values from data[start..] to segm
+	if drift removal is selected, the straight line from detrend_coeffs
+	is subtracted from the values copied to segm
+	a compact series is converted, its mean subtracted and scaled by ulsb
 */
 static void
-remove_drift (double *segm, double *data, int nfft, int LR)
+remove_drift (double *segm, const tDTIDX * dt, long long start,
+	      long long nfft, int LR)
 {
-  int i;
-  long double sx, sy, stt, sty, xm, t;
+  long long i;
   double a,b;
+  const double *data = smp_block (dt, start, nfft, segm);
   
-  if (LR == 2)  { /* subtract straight line through first and last point */
-    a = data[0];
-    b = data[nfft - 1] - data[0] / (double) (nfft - 1.0);
-
-    for (i = 0; i < nfft; i++)  {
-      segm[i] = data[i] - (a + b * i);
-    }
-
-  }
-
-  else if (LR == 1) { /* linear regression */
-    sx = sy = 0;
-    for (i = 0; i < nfft; i++)  {
-	    sx += i;
-	    sy += data[i];
-    }
-
-    xm = sx / nfft;
-    stt = sty = 0;
-    for (i = 0; i < nfft; i++)  {
-      t = i - xm;
-      stt += t * t;
-      sty += t * data[i];
-	  }
-
-    b = sty / stt;
-    a = (sy - sx * b) / nfft;
-
-    for (i = 0; i < nfft; i++)  {
-      segm[i] = data[i] - (a + b * i);
-    }
-
-  } //end-if linear regression
-
-  else if (LR == 0) { /* no detrending, just copy data */
+  if (LR == 0 && dt->mean == 0 && dt->ulsb == 1) { /* no detrending, just copy data */
       
     for (i = 0; i < nfft; i++)  {
       segm[i] = data[i];
 	  }
 
   } //end-if no-detrend
-} //end-of remove_drift()
-
-static void
-remove_drift2 (double *a, double *b, double *data, int nfft, int LR)
-{
-  int i;
-  long double sx, sy, stt, sty, xm, ndbl;
-
-  if (LR == 2)  { /* subtract straight line through first and last point */
-      *a = data[0];
-      *b = data[nfft - 1] - data[0] / (double) (nfft - 1.0);
-  }
 
-  else if (LR == 1) { /* linear regression */
-    ndbl = (long double) nfft;
-    xm = (ndbl - 1.0L) / 2.0L;
-    sx = ndbl * xm;
-    stt = (ndbl * ndbl - 1.0L) * ndbl / 12.0L;
-    sy = sty = 0.L;
+  else { /* linear regression or line through first and last point */
+    detrend_coeffs (dt, start, nfft, LR, &a, &b);
 
     for (i = 0; i < nfft; i++)  {
-      sy += data[i];
-      sty += (i - xm) * data[i];
-	  }
+      segm[i] = (data[i] - (a + b * i)) * dt->ulsb;
+    }
 
-    *b = sty / stt;
-    *a = (sy - sx * *b) / nfft;
-    
-  } //end-elseif linear regression
+  } //end-if detrend
+} //end-of remove_drift()
 
-  else if (LR == 0){  /* copy data */
-    //*a = 1.0;
-	  *a = 0.0;
-    *b = 0.0;
-  } //end-if no detrend
-} //end-of remove_drift2
+/* 
+	offset between the starts of two consecutive segments of length nfft
+	overlapping by ovlp percent, rounded down, at least 1
+*/
+static long long
+segment_offset (long long nfft, double ovlp)
+{
+  long long xOlap = round( (double)nfft * (ovlp / 100.) );
+  
+  return MAX( 1, nfft - xOlap );
+}
 
 
 /********************************************************************************
@@ -234,36 +296,37 @@ remove_drift2 (double *a, double *b, double *data, int nfft, int LR)
  *			rslt[2]=PS rslt[3]=variance(PS)
  ********************************************************************************/
 static void
-getDFT (int nfft, double bin, double fsamp, double ovlp, int LR, double *rslt,
-	      int *avg)
+getDFT (long long nfft, double bin, double fsamp, double ovlp, int LR,
+	      const tDTIDX * dt, double *rslt, long long *avg)
 {
-  double *dwincs;		/* pointer to array containing window function*cos,window function*sin */
-  int i, j;
+  double *wcos, *wsin;		/* window function*cos, window function*(-sin) */
+  long long i;
   double dft_re, dft_im;	/* real and imaginary part of DFT */
-  int start;			/* first index in data array */
-  double *data;			/* start address of data */
+  long long start;		/* first index in data array */
+  long long nread = dt->n;	/* number of data */
   double dft2;			/* sum of real part squared and imag part squared */
-  int nsum;			/* number of summands */
+  long long nsum;			/* number of summands */
   double *segm;			/* contains data of one segment without drift */
 
   double west_q, west_r, west_temp;
   double west_sumw;		/* temp variable for West's averaging */
   double west_m, west_t;
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  double nenbw;			/* normalized equivalent noise bandwidth */
+  double w0[2], w1[2];		/* not used here */
 
   /* calculate window function */
-  dwincs = (double *) xmalloc (2 * nfft * sizeof (double));
-  assert (dwincs != 0);
+  wcos = (double *) xmalloc (nfft * sizeof (double));
+  wsin = (double *) xmalloc (nfft * sizeof (double));
+  assert (wcos != 0 && wsin != 0);
 
-  makewinsincos (nfft, bin, dwincs, &winsum, &winsum2, &nenbw);
-
-  data = get_data ();
-  assert (data != 0);
+  makewinsincos (nfft, bin, wcos, wsin, &winsum, &winsum2, &nenbw, w0, w1);
 
   segm = (double *) xmalloc (nfft * sizeof (double));
   assert (segm != 0);
 
   /* remove drift from first data segment */
-  remove_drift (&segm[0], &data[0], nfft, LR);
+  remove_drift (&segm[0], dt, 0, nfft, LR);
 
   start = 0;
   dft2 = 0.;
@@ -271,9 +334,9 @@ getDFT (int nfft, double bin, double fsamp, double ovlp, int LR, double *rslt,
 
   /* calculate first DFT */
   dft_re = dft_im = 0.;
-  for (i = 0, j = 0; i < nfft; i++, j += 2) {
-    dft_re += dwincs[j] * segm[i];
-    dft_im += dwincs[j + 1] * segm[i];
+  for (i = 0; i < nfft; i++) {
+    dft_re += wcos[i] * segm[i];
+    dft_im += wsin[i] * segm[i];
   }
 
   dft2 = dft_re * dft_re + dft_im * dft_im;
@@ -282,19 +345,17 @@ getDFT (int nfft, double bin, double fsamp, double ovlp, int LR, double *rslt,
   west_t = 0.;
 
   //start += nfft * (1.0 - (double) (ovlp / 100.));	/* go to next segment */
-  int xOlap = round( (double)nfft * (ovlp / 100.) );
-  //int segOffset = MAX(1, floor(nfft * (1.0 - (double)(ovlp / 100.))));
-  int segOffset = MAX(1, nfft - xOlap);
+  long long segOffset = segment_offset (nfft, ovlp);
   start += segOffset; /* go to next segment */
   /* process other segments if available */
   while (start + nfft <= nread) { //(start + nfft < nread)
-      remove_drift (&segm[0], &data[start], nfft, LR);
+      remove_drift (&segm[0], dt, start, nfft, LR);
 
       /* calculate DFT */
       dft_re = dft_im = 0.;
-      for (i = 0, j = 0; i < nfft; i++, j += 2) {
-        dft_re += dwincs[j] * segm[i];
-        dft_im += dwincs[j + 1] * segm[i];
+      for (i = 0; i < nfft; i++) {
+        dft_re += wcos[i] * segm[i];
+        dft_im += wsin[i] * segm[i];
 	    }
 
       dft2 = dft_re * dft_re + dft_im * dft_im;
@@ -334,53 +395,51 @@ getDFT (int nfft, double bin, double fsamp, double ovlp, int LR, double *rslt,
 
   /* clean up */
   xfree (segm);
-  xfree (dwincs);
+  xfree (wsin);
+  xfree (wcos);
 }
 
 static void
-getDFT2 (int nfft, double bin, double fsamp, double ovlp, int LR,
-	      double *rslt, int *avg)
+getDFT2 (long long nfft, double bin, double fsamp, double ovlp, int LR,
+	      const tDTIDX * dt, double *rslt, long long *avg)
 {
-  double *dwincs;		/* pointer to array containing window function*cos,window function*sin */
-  int i;
+  double *wcos, *wsin;		/* window function*cos, window function*(-sin) */
   double dft_re, dft_im;	/* real and imaginary part of DFT */
-  int start;			/* first index in data array */
-  double *data;			/* start address of data */
+  long long start;		/* first index in data array */
+  long long nread = dt->n;	/* number of data */
   double dft2;			/* sum of real part squared and imag part squared */
-  int nsum;			/* number of summands */
+  long long nsum;			/* number of summands */
   double a, b;			/* linear regression results */
-  double y;			/* time series detrended with window */
-  double *winp, *datp;
 
   double west_q, west_r, west_temp;
   double west_sumw;		/* temp variable for West's averaging */
   double west_m, west_t;
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  double w0[2], w1[2];		/* DFT of window and of window times index */
+  const tWINTAB *wt;		/* cached window values of length nfft */
 
   /* calculate window function */
-  dwincs = (double *) xmalloc (2 * nfft * sizeof (double));
-  assert (dwincs != 0);
-
-  makewinsincos (nfft, bin, dwincs, &winsum, &winsum2, &nenbw);
+  wcos = (double *) xmalloc_align (DFT_ALIGN, nfft * sizeof (double));
+  wsin = (double *) xmalloc_align (DFT_ALIGN, nfft * sizeof (double));
+  assert (wcos != 0 && wsin != 0);
 
-  data = get_data ();
-  assert (data != 0);
+  wt = wincache_get (nfft);
+  modwinsincos (nfft, bin, wt->win, wcos, wsin, w0, w1);
+  winsum = wt->winsum;
+  winsum2 = wt->winsum2;
+  wincache_release (wt);
 
-  /* remove drift from first data segment */
-  remove_drift2 (&a, &b, &data[0], nfft, LR);
+  /* drift of first data segment */
+  detrend_coeffs (dt, 0, nfft, LR, &a, &b);
 
   start = 0;
   dft2 = 0.;
   nsum = 1;
 
-  /* calculate first DFT */
-  dft_re = dft_im = 0.;
-  datp = data;
-  winp = dwincs;
-  for (i = 0; i < nfft; i++)  {
-    y = *(datp++) - (a + b * i);
-    dft_re += *(winp++) * y;
-    dft_im += *(winp++) * y;
-  }
+  /* calculate first DFT, then take out the DFT of the drift a + b*i */
+  dft_dot_smp (dt, 0, wcos, wsin, nfft, &dft_re, &dft_im);
+  dft_re = (dft_re - (a * w0[0] + b * w1[0])) * dt->ulsb;
+  dft_im = (dft_im - (a * w0[1] + b * w1[1])) * dt->ulsb;
 
   dft2 = dft_re * dft_re + dft_im * dft_im;
   west_sumw = 1.;
@@ -388,24 +447,16 @@ getDFT2 (int nfft, double bin, double fsamp, double ovlp, int LR,
   west_t = 0.;
 
   //start += nfft * (1.0 - (double) (ovlp / 100.));	/* go to next segment */
-  int xOlap = round( (double)nfft * (ovlp / 100.) );
-  //int segOffset = MAX(1, floor(nfft * (1.0 - (double)(ovlp / 100.))));
-  int segOffset = MAX( 1, nfft - xOlap );
+  long long segOffset = segment_offset (nfft, ovlp);
   start += segOffset; /* go to next segment */
   /* process other segments if available */
   while (start + nfft <= nread) { //(start + nfft < nread)
-    remove_drift2 (&a, &b, &data[start], nfft, LR);
+    detrend_coeffs (dt, start, nfft, LR, &a, &b);
 
     /* calculate DFT */
-    dft_re = dft_im = 0.;
-    datp = data + start;
-    winp = dwincs;
-
-    for (i = 0; i < nfft; i++)  {
-      y = *(datp++) - (a + b * i);
-      dft_re += *(winp++) * y;
-      dft_im += *(winp++) * y;
-    }
+    dft_dot_smp (dt, start, wcos, wsin, nfft, &dft_re, &dft_im);
+    dft_re = (dft_re - (a * w0[0] + b * w1[0])) * dt->ulsb;
+    dft_im = (dft_im - (a * w0[1] + b * w1[1])) * dt->ulsb;
 
     dft2 = dft_re * dft_re + dft_im * dft_im;
 
@@ -443,7 +494,510 @@ getDFT2 (int nfft, double bin, double fsamp, double ovlp, int LR,
   *avg = nsum;
 
   /* clean up */
-  xfree (dwincs);
+  xfree (wsin);
+  xfree (wcos);
+}
+
+/*
+	adds the squared magnitude dft2 of one more segment to West's running
+	mean *m and sum of squared deviations *t of the *nsum segments so far
+*/
+static void
+west_add (double dft2, long long *nsum, double *m, double *t)
+{
+  double west_q, west_r, west_temp;
+  double west_sumw = *nsum;	/* temp variable for West's averaging */
+
+  if (*nsum == 0)
+    {
+      *m = dft2;
+      *t = 0.;
+    }
+  else
+    {
+      west_q = dft2 - *m;
+      west_temp = west_sumw + 1.;
+      west_r = west_q / west_temp;
+      *m += west_r;
+      *t += west_r * west_sumw * west_q;
+    }
+  (*nsum)++;
+}
+
+/*
+	scales West's mean m and sum of squared deviations t of nsum segments
+	to PSD, its variance, PS and its variance in rslt[0..3]
+*/
+static void
+west_result (double m, double t, long long nsum, double fsamp, double winsum,
+	     double winsum2, double *rslt)
+{
+  rslt[0] = m;
+  if (nsum > 2)
+    rslt[1] = sqrt (t / ((double) nsum - 1.));
+  else
+    rslt[1] = rslt[0];
+
+  rslt[2] = rslt[0];
+  rslt[3] = rslt[1];
+  rslt[0] *= 2. / (fsamp * winsum2);	/* power spectral density */
+  rslt[1] *= 2. / (fsamp * winsum2);	/* variance of power spectral density */
+  rslt[2] *= 2. / (winsum * winsum);	/* power spectrum */
+  rslt[3] *= 2. / (winsum * winsum);	/* variance of power spectrum */
+}
+
+/*
+	detrends the DFTs of nseg segments, starting segOffset samples apart,
+	by subtracting a*W0 + b*W1, scales them by ulsb and averages their
+	squared magnitudes with West's algorithm in the same order as getDFT2()
+
+	input
+		seg_re, seg_im	windowed DFTs of the raw data of every segment
+		w0, w1		DFT of the window and of window times index
+*/
+static void
+average_segments (const double *seg_re, const double *seg_im,
+		  long long nseg, long long segOffset, long long nfft, int LR,
+		  const tDTIDX * dt, const double *w0, const double *w1,
+		  double fsamp, double winsum, double winsum2, double *rslt,
+		  long long *avg)
+{
+  double dft_re, dft_im;	/* real and imaginary part of DFT */
+  double dft2;			/* sum of real part squared and imag part squared */
+  long long nsum;		/* number of summands */
+  double a, b;			/* linear regression results */
+  double west_m, west_t;	/* West's running mean and sum of squares */
+  long long s;
+
+  west_m = 0.;
+  west_t = 0.;
+  for (s = 0, nsum = 0; s < nseg; s++)
+    {
+      detrend_coeffs (dt, s * segOffset, nfft, LR, &a, &b);
+      dft_re = (seg_re[s] - (a * w0[0] + b * w1[0])) * dt->ulsb;
+      dft_im = (seg_im[s] - (a * w0[1] + b * w1[1])) * dt->ulsb;
+      dft2 = dft_re * dft_re + dft_im * dft_im;
+      west_add (dft2, &nsum, &west_m, &west_t);
+    }
+
+  /* return result */
+  west_result (west_m, west_t, nsum, fsamp, winsum, winsum2, rslt);
+  *avg = nsum;
+}
+
+/*
+	table-free variant of getDFT2() for bins with very large nfft
+
+	getDFT2() keeps window*cos and window*(-sin) for the whole segment,
+	i.e. 16*nfft bytes, and streams them from memory once per segment.
+	Here the kernel table is generated for blocks of TFBLOCK samples by
+	phasor_fill() and is applied to this block of every segment before
+	the next block is generated, so it never leaves the cache. The window
+	values are taken from the window cache if a table of length nfft fits
+	into its budget (wincache), otherwise they are computed block by block.
+
+	The partial DFTs of all segments are kept until the last block, then
+	they are detrended and averaged in the same order as in getDFT2().
+*/
+static void
+getDFT3 (long long nfft, double bin, double fsamp, double ovlp, int LR,
+	 const tDTIDX * dt, double wincache, double *rslt, long long *avg)
+{
+  double *bcos, *bsin;		/* window*cos, window*(-sin) of one block */
+  double *bwin;			/* window values of one block */
+  double *seg_re, *seg_im;	/* partial DFTs of all segments */
+  const tWINTAB *wt = NULL;	/* cached window, if it fits into the budget */
+  double dft_re, dft_im;	/* real and imaginary part of DFT */
+  long long nread = dt->n;	/* number of data */
+  long long nseg;		/* number of segments */
+  long long segOffset;
+  long long jb, s;
+  int len, j;
+  const double *win;
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  long double w0re = 0, w0im = 0, w1re = 0, w1im = 0;
+  double w0[2], w1[2];		/* DFT of window and of window times index */
+
+  segOffset = segment_offset (nfft, ovlp);
+  nseg = (nread >= nfft) ? (nread - nfft) / segOffset + 1 : 1;
+
+  bcos = (double *) xmalloc_align (DFT_ALIGN, TFBLOCK * sizeof (double));
+  bsin = (double *) xmalloc_align (DFT_ALIGN, TFBLOCK * sizeof (double));
+  bwin = (double *) xmalloc (TFBLOCK * sizeof (double));
+  seg_re = (double *) xmalloc (nseg * sizeof (double));
+  seg_im = (double *) xmalloc (nseg * sizeof (double));
+  for (s = 0; s < nseg; s++)
+    seg_re[s] = seg_im[s] = 0;
+
+  if (nfft * sizeof (double) <= wincache * 1048576.)
+    wt = wincache_get (nfft);
+  winsum = winsum2 = 0;
+
+  for (jb = 0; jb < nfft; jb += TFBLOCK)
+    {
+      len = (nfft - jb < TFBLOCK) ? nfft - jb : TFBLOCK;
+
+      /* kernel table of this block */
+      if (wt)
+	win = wt->win + jb;
+      else
+	{
+	  makewinpart (nfft, jb, len, bwin);
+	  for (j = 0; j < len; j++)
+	    {
+	      winsum += bwin[j];
+	      winsum2 += bwin[j] * bwin[j];
+	    }
+	  win = bwin;
+	}
+      phasor_fill (bin, nfft, jb, len, bcos, bsin);
+      for (j = 0; j < len; j++)
+	{
+	  bcos[j] = bcos[j] * win[j];
+	  bsin[j] = -bsin[j] * win[j];
+	  w0re += bcos[j];
+	  w0im += bsin[j];
+	  w1re += (long double) (jb + j) * bcos[j];
+	  w1im += (long double) (jb + j) * bsin[j];
+	}
+
+      /* apply it to this block of every segment */
+      for (s = 0; s < nseg; s++)
+	{
+	  dft_dot_smp (dt, s * segOffset + jb, bcos, bsin, len, &dft_re,
+		       &dft_im);
+	  seg_re[s] += dft_re;
+	  seg_im[s] += dft_im;
+	}
+    }
+  if (wt)
+    {
+      winsum = wt->winsum;
+      winsum2 = wt->winsum2;
+      wincache_release (wt);
+    }
+
+  w0[0] = w0re;
+  w0[1] = w0im;
+  w1[0] = w1re;
+  w1[1] = w1im;
+  average_segments (seg_re, seg_im, nseg, segOffset, nfft, LR, dt, w0, w1,
+		    fsamp, winsum, winsum2, rslt, avg);
+
+  /* clean up */
+  xfree (seg_im);
+  xfree (seg_re);
+  xfree (bwin);
+  xfree (bsin);
+  xfree (bcos);
+}
+
+/*
+	sliding-DFT variant of getDFT3() for cosine-sum windows
+
+	The windowed DFTs of all segments are combined from prefix sums of the
+	data at the 2*ncos-1 frequencies bin-ncos+1..bin+ncos-1 (sdft.c), which
+	costs about (2*ncos-1)*nread operations instead of nfft*nseg, whatever
+	the overlap. Window sums and W0, W1 are accumulated block by block.
+*/
+static void
+getDFT4 (long long nfft, double bin, double fsamp, double ovlp, int LR,
+	 const tDTIDX * dt, const double *cw, int ncos, double *rslt,
+	 long long *avg)
+{
+  double *bcos, *bsin;		/* cos, sin of one block */
+  double *bwin;			/* window values of one block */
+  double *seg_re, *seg_im;	/* DFTs of all segments */
+  long long nread = dt->n;	/* number of data */
+  long long nseg;		/* number of segments */
+  long long segOffset;
+  long long jb;
+  int len, j;
+  double wc, ws;
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  long double w0re = 0, w0im = 0, w1re = 0, w1im = 0;
+  double w0[2], w1[2];		/* DFT of window and of window times index */
+
+  segOffset = segment_offset (nfft, ovlp);
+  nseg = (nread >= nfft) ? (nread - nfft) / segOffset + 1 : 1;
+
+  bcos = (double *) xmalloc_align (DFT_ALIGN, TFBLOCK * sizeof (double));
+  bsin = (double *) xmalloc_align (DFT_ALIGN, TFBLOCK * sizeof (double));
+  bwin = (double *) xmalloc (TFBLOCK * sizeof (double));
+  seg_re = (double *) xmalloc (nseg * sizeof (double));
+  seg_im = (double *) xmalloc (nseg * sizeof (double));
+
+  sdft_segments (dt, nfft, bin, segOffset, nseg, cw, ncos, seg_re,
+		 seg_im);
+
+  /* window sums and W0, W1 */
+  winsum = winsum2 = 0;
+  for (jb = 0; jb < nfft; jb += TFBLOCK)
+    {
+      len = (nfft - jb < TFBLOCK) ? nfft - jb : TFBLOCK;
+      makewinpart (nfft, jb, len, bwin);
+      phasor_fill (bin, nfft, jb, len, bcos, bsin);
+      for (j = 0; j < len; j++)
+	{
+	  winsum += bwin[j];
+	  winsum2 += bwin[j] * bwin[j];
+	  wc = bcos[j] * bwin[j];
+	  ws = -bsin[j] * bwin[j];
+	  w0re += wc;
+	  w0im += ws;
+	  w1re += (long double) (jb + j) * wc;
+	  w1im += (long double) (jb + j) * ws;
+	}
+    }
+
+  w0[0] = w0re;
+  w0[1] = w0im;
+  w1[0] = w1re;
+  w1[1] = w1im;
+  average_segments (seg_re, seg_im, nseg, segOffset, nfft, LR, dt, w0, w1,
+		    fsamp, winsum, winsum2, rslt, avg);
+
+  /* clean up */
+  xfree (seg_im);
+  xfree (seg_re);
+  xfree (bwin);
+  xfree (bsin);
+  xfree (bcos);
+}
+
+/*
+	computes a run of nb bins bin0, bin0+1, ..., bin0+nb-1 that share nfft
+	with one FFT per segment instead of nb DFTs
+
+	With bin0 = n0 + delta, n0 integer, the DFT at bin0+m is the FFT of
+	x[j]*w[j]*exp(-i*2*pi*delta*j/nfft) at index n0+m. The drift a + b*j of
+	a segment is taken out with W0, W1 of every bin, which are FFTs of the
+	modulated window and of j times the modulated window.
+	Needs 2*16*nfft bytes for the modulated window and the FFT buffer.
+
+	output
+		rslt	PSD, var(PSD), PS, var(PS) of bin m in rslt[4*m..4*m+3]
+		avg	number of averages of every bin
+*/
+static void
+getDFTrun (long long nfft, double bin0, int nb, double fsamp, double ovlp,
+	   int LR, const tDTIDX * dt, double *rslt, long long *avg)
+{
+  fftw_complex *mwin;		/* window * exp(-i*2*pi*delta*j/nfft) */
+  fftw_complex *buf;		/* FFT input and output */
+  double *w0, *w1;		/* W0, W1 of bin m in w0[2*m], w0[2*m+1] */
+  double *west_m, *west_t;	/* West's averaging of every bin */
+  double *bcos, *bsin;
+  const tWINTAB *wt;
+  const tFFTPLAN *fp;
+  long long nread = dt->n;	/* number of data */
+  long long n0, jb, j, idx;
+  long long start, segOffset, nsum;
+  int len, m;
+  double delta, a, b;
+  double dft_re, dft_im, dft2;
+  double west_q, west_r, west_sumw;
+  double *xb;			/* raw samples of a compact series */
+  const double *x;
+
+  n0 = (long long) floor (bin0);
+  delta = bin0 - n0;
+
+  mwin = (fftw_complex *) fftw_malloc (nfft * sizeof (fftw_complex));
+  buf = (fftw_complex *) fftw_malloc (nfft * sizeof (fftw_complex));
+  if (mwin == NULL || buf == NULL)
+    gerror ("Cannot allocate FFT buffers");
+  w0 = (double *) xmalloc (2 * nb * sizeof (double));
+  w1 = (double *) xmalloc (2 * nb * sizeof (double));
+  west_m = (double *) xmalloc (nb * sizeof (double));
+  west_t = (double *) xmalloc (nb * sizeof (double));
+
+  fp = fftplan_get (FP_DFT, nfft, 1, 0);
+
+  /* modulated window */
+  wt = wincache_get (nfft);
+  bcos = (double *) xmalloc (TFBLOCK * sizeof (double));
+  bsin = (double *) xmalloc (TFBLOCK * sizeof (double));
+  for (jb = 0; jb < nfft; jb += TFBLOCK)
+    {
+      len = (nfft - jb < TFBLOCK) ? nfft - jb : TFBLOCK;
+      phasor_fill (delta, nfft, jb, len, bcos, bsin);
+      for (j = 0; j < len; j++)
+	{
+	  mwin[jb + j][0] = bcos[j] * wt->win[jb + j];
+	  mwin[jb + j][1] = -bsin[j] * wt->win[jb + j];
+	}
+    }
+  xfree (bsin);
+  xfree (bcos);
+
+  /* W0 and W1 of all bins */
+  for (j = 0; j < nfft; j++)
+    {
+      buf[j][0] = mwin[j][0];
+      buf[j][1] = mwin[j][1];
+    }
+  fftw_execute_dft (fp->plan, buf, buf);
+  for (m = 0; m < nb; m++)
+    {
+      idx = (n0 + m) % nfft;
+      w0[2 * m] = buf[idx][0];
+      w0[2 * m + 1] = buf[idx][1];
+    }
+  for (j = 0; j < nfft; j++)
+    {
+      buf[j][0] = j * mwin[j][0];
+      buf[j][1] = j * mwin[j][1];
+    }
+  fftw_execute_dft (fp->plan, buf, buf);
+  for (m = 0; m < nb; m++)
+    {
+      idx = (n0 + m) % nfft;
+      w1[2 * m] = buf[idx][0];
+      w1[2 * m + 1] = buf[idx][1];
+    }
+
+  /* all segments */
+  xb = (double *) xmalloc (TFBLOCK * sizeof (double));
+  segOffset = segment_offset (nfft, ovlp);
+  west_sumw = 0;
+  nsum = 0;
+  for (start = 0; nsum == 0 || start + nfft <= nread; start += segOffset)
+    {
+      for (jb = 0; jb < nfft; jb += TFBLOCK)
+	{
+	  len = (nfft - jb < TFBLOCK) ? nfft - jb : TFBLOCK;
+	  x = smp_block (dt, start + jb, len, xb);
+	  for (j = 0; j < len; j++)
+	    {
+	      buf[jb + j][0] = x[j] * mwin[jb + j][0];
+	      buf[jb + j][1] = x[j] * mwin[jb + j][1];
+	    }
+	}
+      fftw_execute_dft (fp->plan, buf, buf);
+      detrend_coeffs (dt, start, nfft, LR, &a, &b);
+      for (m = 0; m < nb; m++)
+	{
+	  idx = (n0 + m) % nfft;
+	  dft_re = (buf[idx][0] - (a * w0[2 * m] + b * w1[2 * m])) * dt->ulsb;
+	  dft_im = (buf[idx][1] - (a * w0[2 * m + 1] + b * w1[2 * m + 1]))
+	    * dt->ulsb;
+	  dft2 = dft_re * dft_re + dft_im * dft_im;
+	  if (nsum == 0)
+	    {
+	      west_m[m] = dft2;
+	      west_t[m] = 0;
+	    }
+	  else
+	    {
+	      west_q = dft2 - west_m[m];
+	      west_r = west_q / (west_sumw + 1.);
+	      west_m[m] += west_r;
+	      west_t[m] += west_r * west_sumw * west_q;
+	    }
+	}
+      west_sumw += 1.;
+      nsum++;
+    }
+
+  /* return results */
+  for (m = 0; m < nb; m++)
+    {
+      rslt[4 * m] = west_m[m];
+      if (nsum > 2)
+	rslt[4 * m + 1] = sqrt (west_t[m] / ((double) nsum - 1.));
+      else
+	rslt[4 * m + 1] = rslt[4 * m];
+      rslt[4 * m + 2] = rslt[4 * m] * 2. / (wt->winsum * wt->winsum);
+      rslt[4 * m + 3] = rslt[4 * m + 1] * 2. / (wt->winsum * wt->winsum);
+      rslt[4 * m] *= 2. / (fsamp * wt->winsum2);
+      rslt[4 * m + 1] *= 2. / (fsamp * wt->winsum2);
+      avg[m] = nsum;
+    }
+
+  /* clean up */
+  xfree (xb);
+  wincache_release (wt);
+  fftplan_release (fp);
+  xfree (west_t);
+  xfree (west_m);
+  xfree (w1);
+  xfree (w0);
+  fftw_free (buf);
+  fftw_free (mwin);
+}
+
+/*
+	computes nb bins with the same nfft, e.g. a group of grid mode, in one
+	pass over the segments: the window and the drift a + b*j of every
+	segment are taken once for all bins, and each segment is applied to
+	the tables of all bins while it is in the cache
+	Needs 2*8*nfft*nb bytes for the tables.
+
+	output
+		rslt	PSD, var(PSD), PS, var(PS) of bin m in rslt[4*m..4*m+3]
+		avg	number of averages of every bin
+*/
+static void
+getDFTgroup (long long nfft, const double *bins, int nb, double fsamp,
+	     double ovlp, int LR, const tDTIDX * dt, double *rslt,
+	     long long *avg)
+{
+  double *wcos, *wsin;		/* window*cos, window*(-sin) of bin m at m*nfft */
+  double *w0, *w1;		/* W0, W1 of bin m in w0[2*m], w0[2*m+1] */
+  double *west_m, *west_t;	/* West's averaging of every bin */
+  const tWINTAB *wt;
+  long long nread = dt->n;	/* number of data */
+  long long start, segOffset, nsum, n;
+  int m;
+  double a, b, dft_re, dft_im;
+
+  wcos = (double *) xmalloc_align (DFT_ALIGN, nb * nfft * sizeof (double));
+  wsin = (double *) xmalloc_align (DFT_ALIGN, nb * nfft * sizeof (double));
+  w0 = (double *) xmalloc (2 * nb * sizeof (double));
+  w1 = (double *) xmalloc (2 * nb * sizeof (double));
+  west_m = (double *) xmalloc (nb * sizeof (double));
+  west_t = (double *) xmalloc (nb * sizeof (double));
+
+  wt = wincache_get (nfft);
+  for (m = 0; m < nb; m++)
+    modwinsincos (nfft, bins[m], wt->win, &wcos[m * nfft], &wsin[m * nfft],
+		  &w0[2 * m], &w1[2 * m]);
+
+  segOffset = segment_offset (nfft, ovlp);
+  nsum = 0;
+  for (start = 0; nsum == 0 || start + nfft <= nread; start += segOffset)
+    {
+      detrend_coeffs (dt, start, nfft, LR, &a, &b);
+      for (m = 0; m < nb; m++)
+	{
+	  dft_dot_smp (dt, start, &wcos[m * nfft], &wsin[m * nfft], nfft,
+		       &dft_re, &dft_im);
+	  dft_re = (dft_re - (a * w0[2 * m] + b * w1[2 * m])) * dt->ulsb;
+	  dft_im = (dft_im - (a * w0[2 * m + 1] + b * w1[2 * m + 1]))
+	    * dt->ulsb;
+	  n = nsum;
+	  west_add (dft_re * dft_re + dft_im * dft_im, &n, &west_m[m],
+		    &west_t[m]);
+	}
+      nsum++;
+    }
+
+  for (m = 0; m < nb; m++)
+    {
+      west_result (west_m[m], west_t[m], nsum, fsamp, wt->winsum,
+		   wt->winsum2, &rslt[4 * m]);
+      avg[m] = nsum;
+    }
+
+  /* clean up */
+  wincache_release (wt);
+  xfree (west_t);
+  xfree (west_m);
+  xfree (w1);
+  xfree (w0);
+  xfree (wsin);
+  xfree (wcos);
 }
 
 /*
@@ -473,13 +1027,18 @@ static void
 calc_params (tCFG * cfg, tDATA * data)
 {
   double fres, f;
-  int i, ndft;
+  int i;
+  long long ndft;
   double bin;
   double navg;
   double ovfact, xov;
   double fresa, fresb, fresc;
   double logfact;
+  long long nread = (*data).nread;
+  long long nsmooth;
+  double rbwdev;
 
+  (*data).gridrbw = 0;
   ovfact = 1. / (1. - (*cfg).ovlp / 100.);
   xov = (1. - (*cfg).ovlp / 100.);
 
@@ -499,6 +1058,17 @@ calc_params (tCFG * cfg, tDATA * data)
 
     if (fres < fresc) fres = fresc;
     ndft = round ((*cfg).fsamp / fres);
+    /* grid mode: nearest 7-smooth nfft below if it is close enough; never
+       above, the bins would be denser than nspec */
+    if ((*cfg).gridtol > 0) {
+      nsmooth = round_smooth (ndft, ndft);
+      if (ndft - nsmooth <= (*cfg).gridtol / 100. * nsmooth) {
+        /* the resolution bandwidth is proportional to 1/nfft */
+        rbwdev = fabs ((double) ndft / nsmooth - 1.);
+        if (rbwdev > (*data).gridrbw) (*data).gridrbw = rbwdev;
+        ndft = nsmooth;
+      }
+    }
     fres = (*cfg).fsamp / ndft;
     bin = (f / fres);
     navg = ((double) ((nread - ndft)) * ovfact) / ndft + 1; //not used
@@ -510,72 +1080,1209 @@ calc_params (tCFG * cfg, tDATA * data)
   } //end-for f[i] <= fmax
 
   (*cfg).nspec = i;		/* counter has been increased by 1 by for loop */
+
+  /* distinct nfft, they do not increase with the frequency */
+  for (i = 0, (*data).ngrid = 0; i < (*cfg).nspec; i++)
+    if (i == 0 || (*data).nffts[i] != (*data).nffts[i - 1]) (*data).ngrid++;
+  if ((*cfg).gridtol > 0)
+    printf ("Grid: %d nfft values, max. RBW deviation %.3f %%\n",
+	    (*data).ngrid, 100. * (*data).gridrbw);
 } //end-of calc_params()
 
+/* estimated cost of getDFT4() for nfft and nseg segments */
+static double
+sdft_cost (const tLPSDJOB * job, long long nfft, long long nseg)
+{
+  double D = segment_offset (nfft, (*job->cfg).ovlp);
+
+  return (2 * job->ncos - 1) * (SDFTCOST * ((nseg - 1) * D + nfft)
+				+ SDFTSEG * nseg);
+}
+
+/*
+	cost models of the kernels: estimated cost of nb bins with nfft and
+	nseg segments in terms of one term of the direct DFT, negative if
+	the kernel cannot or must not compute them
+	SDFT 2 leaves only the sliding DFT for single bins of a cosine-sum
+	window, SDFT 0 excludes it; TFNFFT splits the bins between getDFT2()
+	and getDFT3(), which have the same cost; groups of getDFTgroup() are
+	formed in grid mode only, their tables must fit into GROUPMEM
+*/
+static int
+sdft_forced (const tLPSDJOB * job)
+{
+  return job->ncos > 0 && (*job->cfg).sdft == 2;
+}
+
+static double
+cost_fftrun (const tLPSDJOB * job, long long nfft, long long nseg, int nb)
+{
+  (void) job;
+  if (!FAST || nb < 2)
+    return -1;
+  return FFTBATCH * log2 (nfft) * nfft * (double) nseg;
+}
+
+static double
+cost_direct (const tLPSDJOB * job, long long nfft, long long nseg, int nb)
+{
+  int tf = (*job->cfg).tfnfft;
+
+  if (!FAST || sdft_forced (job) || (tf > 0 && nfft >= tf))
+    return -1;
+  return (double) nfft * nseg * nb;
+}
+
+static double
+cost_tablefree (const tLPSDJOB * job, long long nfft, long long nseg, int nb)
+{
+  int tf = (*job->cfg).tfnfft;
+
+  if (!FAST || sdft_forced (job) || tf <= 0 || nfft < tf)
+    return -1;
+  return (double) nfft * nseg * nb;
+}
+
+static double
+cost_sdft (const tLPSDJOB * job, long long nfft, long long nseg, int nb)
+{
+  if (!FAST || job->ncos == 0 || (*job->cfg).sdft == 0)
+    return -1;
+  return sdft_cost (job, nfft, nseg) * nb;
+}
+
+static double
+cost_group (const tLPSDJOB * job, long long nfft, long long nseg, int nb)
+{
+  int tf = (*job->cfg).tfnfft;
+
+  if (!FAST || (*job->cfg).gridtol <= 0 || sdft_forced (job) || nb < 2
+      || (tf > 0 && nfft >= tf) || 16. * nfft * nb > GROUPMEM)
+    return -1;
+  return GROUPGAIN * nfft * nseg * nb;
+}
+
+static double
+cost_reference (const tLPSDJOB * job, long long nfft, long long nseg, int nb)
+{
+  (void) job;
+  if (FAST)
+    return -1;
+  return (double) nfft * nseg * nb;
+}
+
+/*
+	the kernels: compute the bins of task r from the series dt with
+	sampling frequency fsamp (the decimated level of the task) and store
+	the results in data
+*/
+static void
+store_bin (tDATA * data, int k, const double *rslt)
+{
+  (*data).psd[k] = rslt[0];
+  (*data).varpsd[k] = rslt[1];
+  (*data).ps[k] = rslt[2];
+  (*data).varps[k] = rslt[3];
+}
+
+static void
+kern_fftrun (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+	     double fsamp)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  int k = r->first, m;
+  double *runrslt;
+
+  runrslt = (double *) xmalloc (4 * r->count * sizeof (double));
+  getDFTrun (r->nfft, (*data).bins[k], r->count, fsamp, (*cfg).ovlp,
+	     (*cfg).LR, dt, runrslt, &(*data).avg[k]);
+  for (m = 0; m < r->count; m++)
+    store_bin (data, k + m, &runrslt[4 * m]);
+  xfree (runrslt);
+}
+
+static void
+kern_direct (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+	     double fsamp)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  int k = r->first;
+  double rslt[4];
+
+  getDFT2 (r->nfft, (*data).bins[k], fsamp, (*cfg).ovlp, (*cfg).LR, dt,
+	   rslt, &(*data).avg[k]);
+  store_bin (data, k, rslt);
+}
+
+static void
+kern_tablefree (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+		double fsamp)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  int k = r->first;
+  double rslt[4];
+
+  getDFT3 (r->nfft, (*data).bins[k], fsamp, (*cfg).ovlp, (*cfg).LR, dt,
+	   (*cfg).wincache, rslt, &(*data).avg[k]);
+  store_bin (data, k, rslt);
+}
+
+static void
+kern_sdft (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+	   double fsamp)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  int k = r->first;
+  double rslt[4];
+
+  getDFT4 (r->nfft, (*data).bins[k], fsamp, (*cfg).ovlp, (*cfg).LR, dt,
+	   job->cw, job->ncos, rslt, &(*data).avg[k]);
+  store_bin (data, k, rslt);
+}
+
+static void
+kern_group (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+	    double fsamp)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  int k = r->first, m;
+  double *grprslt;
+
+  grprslt = (double *) xmalloc (4 * r->count * sizeof (double));
+  getDFTgroup (r->nfft, &(*data).bins[k], r->count, fsamp, (*cfg).ovlp,
+	       (*cfg).LR, dt, grprslt, &(*data).avg[k]);
+  for (m = 0; m < r->count; m++)
+    store_bin (data, k + m, &grprslt[4 * m]);
+  xfree (grprslt);
+}
+
+static void
+kern_reference (const tLPSDJOB * job, const tBINRUN * r, const tDTIDX * dt,
+		double fsamp)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  int k = r->first;
+  double rslt[4];
+
+  getDFT (r->nfft, (*data).bins[k], fsamp, (*cfg).ovlp, (*cfg).LR, dt,
+	  rslt, &(*data).avg[k]);
+  store_bin (data, k, rslt);
+}
+
+/*
+	registry of the kernels, in order of preference at equal cost;
+	a new kernel needs a cost model and an entry here, the planner
+	(plan_bins()) and the frequency loop (lpsd_bin()) pick it up
+*/
+static const tKERNEL kernels[] = {
+  {"FFT run", 1, cost_fftrun, kern_fftrun},
+  {"direct", 0, cost_direct, kern_direct},
+  {"table-free", 0, cost_tablefree, kern_tablefree},
+  {"sliding DFT", 0, cost_sdft, kern_sdft},
+  {"group", 2, cost_group, kern_group},
+  {"reference", 0, cost_reference, kern_reference}
+};
+
+#define NKERNELS ((int) (sizeof (kernels) / sizeof (kernels[0])))
+
+/*
+	computes one task of the plan, called by the workers
+*/
+static void
+lpsd_bin (int task, void *arg)
+{
+  tLPSDJOB *job = (tLPSDJOB *) arg;
+  const tBINRUN *r = &job->run[task];
+  const tDTIDX *dt = job->dt;
+  double fsamp = (*job->cfg).fsamp;
+
+  /* bins on decimated levels: nffts[k] is a multiple of 2^L */
+  if (r->level > 0)
+    {
+      dt = job->pyr->dt[r->level];
+      fsamp = ldexp (fsamp, -r->level);
+    }
+  kernels[r->kern].run (job, r, dt, fsamp);
+}
+
+/*
+	returns the number of bins k, k+1, ... that share nfft and whose bins
+	step by 1, i.e. that can be computed by one getDFTrun()
+*/
+static int
+run_length (const tDATA * data, int k, int nspec)
+{
+  int n = 1;
+
+  while (k + n < nspec
+	 && (*data).nffts[k + n] == (*data).nffts[k]
+	 && fabs ((*data).bins[k + n] - (*data).bins[k] - n) < 1e-6
+	 && n < (*data).nffts[k])
+    n++;
+  return n;
+}
+
+/*
+	returns the coarsest decimation level L on which bin k can be computed:
+	the frequency plus sbin bins must lie in the passband of level L, and
+	nfft/2^L must be at least DECMINNFFT and fit into the level
+	LR == 2 takes the line through the end points of every segment, which
+	depends on the high-frequency content, so it is never decimated
+	nffts[k] and bins[k] are rounded to the nfft = 2^L*round(nfft/2^L)
+	that is actually used, the frequency of the bin is unchanged
+*/
+static int
+bin_level (const tCFG * cfg, tDATA * data, int k)
+{
+  int L;
+  long long nfftL, n;
+  double fsL;
+
+  if ((*cfg).decatt <= 0 || (*cfg).LR == 2)
+    return 0;
+  for (L = 0; L < DECMAXLEV; L++)
+    {
+      n = decimate_length ((*data).nread, L + 1);
+      nfftL = (long long) round (ldexp ((*data).nffts[k], -(L + 1)));
+      fsL = ldexp ((*cfg).fsamp, -(L + 1));
+      if (nfftL < DECMINNFFT || nfftL > n
+	  || (*data).fspec[k] + (*cfg).sbin * fsL / nfftL
+	  > (0.5 - DECTRANS) * fsL)
+	break;
+    }
+  if (L > 0)
+    {
+      (*data).nffts[k] = (long long) round (ldexp ((*data).nffts[k], -L)) << L;
+      (*data).bins[k] = (*data).fspec[k] * (*data).nffts[k] / (*cfg).fsamp;
+    }
+  return L;
+}
+
+static void
+print_progress (double done)
+{
+  printf ("\b\b\b\b\b\b%5.1f%%", 100. * done);
+  fflush (stdout);
+}
+
+/*
+	returns the cheapest kernel with multi for nb bins with nfft and nseg
+	segments and its cost in *cost, -1 if none can compute them
+*/
+static int
+best_kernel (const tLPSDJOB * job, int multi, long long nfft, long long nseg,
+	     int nb, double *cost)
+{
+  int i, best = -1;
+  double c;
+
+  for (i = 0; i < NKERNELS; i++)
+    {
+      if (kernels[i].multi != multi)
+	continue;
+      c = kernels[i].cost (job, nfft, nseg, nb);
+      if (c >= 0 && (best < 0 || c < *cost))
+	{
+	  best = i;
+	  *cost = c;
+	}
+    }
+  return best;
+}
+
+/*
+	builds the execution plan: the tasks and their kernels
+	a run of bins with equal nfft (run_length()) is one task if a run
+	kernel is cheaper than the best single-bin kernels for all its bins;
+	otherwise every bin is a task on its decimation level (bin_level())
+	with the cheapest single-bin kernel there, and consecutive bins with
+	the same nfft on the same level are joined to a group task if a group
+	kernel is cheaper
+	returns the number of tasks, the deepest decimation level in *maxlev
+*/
+static int
+plan_bins (const tLPSDJOB * job, tBINRUN * run, int *maxlev)
+{
+  tCFG *cfg = job->cfg;
+  tDATA *data = job->data;
+  tBINRUN *r, *p;
+  int k, n, m, kn, k1, kg;
+  int nrun = 0;
+  long long nfft, nseg;
+  double cn, c1, cg;
+
+  *maxlev = 0;
+  for (k = 0; k < (*cfg).nspec; k += n)
+    {
+      nfft = (*data).nffts[k];
+      nseg = MAX (1, ((*data).nread - nfft)
+		  / segment_offset (nfft, (*cfg).ovlp) + 1);
+      n = run_length (data, k, (*cfg).nspec);
+      if (n > 1)
+	{
+	  kn = best_kernel (job, 1, nfft, nseg, n, &cn);
+	  k1 = best_kernel (job, 0, nfft, nseg, n, &c1);
+	  if (kn >= 0 && (k1 < 0 || cn < c1))
+	    {
+	      r = &run[nrun++];
+	      r->first = k;
+	      r->count = n;
+	      r->level = 0;
+	      r->kern = kn;
+	      r->nfft = nfft;
+	      r->nseg = nseg;
+	      r->cost = cn;
+	      continue;
+	    }
+	}
+      for (m = 0; m < n; m++)
+	{
+	  r = &run[nrun++];
+	  r->first = k + m;
+	  r->count = 1;
+	  r->level = bin_level (cfg, data, k + m);
+	  r->nfft = (*data).nffts[k + m] >> r->level;
+	  r->nseg = MAX (1, (decimate_length ((*data).nread, r->level)
+			     - r->nfft) / segment_offset (r->nfft,
+							  (*cfg).ovlp) + 1);
+	  r->kern = best_kernel (job, 0, r->nfft, r->nseg, 1, &r->cost);
+	  if (r->kern < 0)
+	    gerror ("No kernel can compute the bins");
+	  *maxlev = MAX (*maxlev, r->level);
+
+	  /* join the previous task to a group if that is cheaper */
+	  if (m == 0)
+	    continue;
+	  p = &run[nrun - 2];
+	  if (p->level != r->level || p->nfft != r->nfft)
+	    continue;
+	  kg = best_kernel (job, 2, r->nfft, r->nseg, p->count + 1, &cg);
+	  if (kg >= 0 && cg < p->cost + r->cost)
+	    {
+	      p->count++;
+	      p->kern = kg;
+	      p->cost = cg;
+	      nrun--;
+	    }
+	}
+    }
+  return nrun;
+}
+
+/*
+	times getDFT2() for a bin with nfft on the first n samples of the
+	series; returns the time, the number of DFT terms in *terms and of
+	table values in *tabs
+*/
+static double
+time_direct (const tLPSDJOB * job, long long nfft, long long n,
+	     double *terms, double *tabs)
+{
+  tCFG *cfg = job->cfg;
+  tDTIDX cal = *job->dt;
+  long long avg;
+  double rslt[4];
+  struct timeval tv;
+  double t0, t1;
+
+  cal.n = n;
+  *terms = *tabs = 0;
+  gettimeofday (&tv, NULL);
+  t0 = tv.tv_sec + tv.tv_usec / 1e6;
+  do
+    {
+      getDFT2 (nfft, nfft / 7.3, (*cfg).fsamp, (*cfg).ovlp, (*cfg).LR, &cal,
+	       rslt, &avg);
+      *terms += (double) nfft * avg;
+      *tabs += nfft;
+      gettimeofday (&tv, NULL);
+      t1 = tv.tv_sec + tv.tv_usec / 1e6;
+    }
+  while (t1 - t0 < PLANCALIBT);
+  return t1 - t0;
+}
+
+/*
+	calibrates the time model of print_plan() from getDFT2() with many
+	segments and with one: the seconds per term of the direct DFT at a
+	small and at a large nfft, whose tables do not fit into the caches,
+	and the seconds per value of the window and kernel tables of a bin;
+	the window cache is off meanwhile, so that every call computes its
+	tables, and the fastest of PLANCALIBREP timings counts
+*/
+static void
+calibrate (const tLPSDJOB * job, tCALIB * cal)
+{
+  long long n = job->dt->n;
+  double ra, rb, rc, qa = 0, qb = 0, qc = 0, a1, b1, a2, b2, a3, b3;
+  int i;
+
+  cal->nfft[0] = MAX (16LL, MIN ((long long) PLANCALIB, n / 4));
+  cal->nfft[1] = MAX (cal->nfft[0], MIN ((long long) PLANCALIBBIG, n / 2));
+  wincache_init (0);
+  for (i = 0; i < PLANCALIBREP; i++)
+    {
+      /* seconds per term */
+      ra = time_direct (job, cal->nfft[0], MIN (n, PLANCALIBSEG
+						* cal->nfft[0]), &a1, &b1) / a1;
+      rb = time_direct (job, cal->nfft[0], cal->nfft[0], &a2, &b2) / a2;
+      rc = time_direct (job, cal->nfft[1], n, &a3, &b3) / a3;
+      qa = (i == 0 || ra < qa) ? ra : qa;
+      qb = (i == 0 || rb < qb) ? rb : qb;
+      qc = (i == 0 || rc < qc) ? rc : qc;
+    }
+  wincache_init ((*job->cfg).wincache * 1048576.);
+
+  /* q = tterm + ttab * tables/terms */
+  cal->ttab = (b2 / a2 > b1 / a1) ? (qb - qa) / (b2 / a2 - b1 / a1) : 0;
+  cal->tterm[0] = qa - cal->ttab * b1 / a1;
+  if (cal->tterm[0] <= 0 || cal->ttab < 0)
+    {
+      cal->tterm[0] = qa;
+      cal->ttab = 0;
+    }
+  cal->tterm[1] = MAX (cal->tterm[0], qc - cal->ttab * b3 / a3);
+}
+
+/*
+	predicted seconds of task r: the time per term is interpolated in
+	log(nfft) between the calibrated nfft and held outside; a run shares
+	its tables, the other kernels have them per bin
+*/
+static double
+task_time (const tCALIB * cal, const tBINRUN * r)
+{
+  double x = 0, tterm;
+
+  if (cal->nfft[1] > cal->nfft[0])
+    x = log ((double) r->nfft / cal->nfft[0])
+      / log ((double) cal->nfft[1] / cal->nfft[0]);
+  x = MAX (0., MIN (1., x));
+  tterm = (1 - x) * cal->tterm[0] + x * cal->tterm[1];
+  return r->cost * tterm
+    + r->nfft * cal->ttab * (kernels[r->kern].multi == 1 ? 1 : r->count);
+}
+
+/*
+	prints the plan: bins, tasks and predicted time of every kernel if
+	PLAN is 1 or 2, and every task if PLAN is 2; the predicted time of a
+	task is its cost in DFT terms plus its tables (task_time())
+*/
+static void
+print_plan (const tLPSDJOB * job, int nrun, int nthreads)
+{
+  const tBINRUN *r;
+  tDATA *data = job->data;
+  int nbins[NKERNELS], ntask[NKERNELS];
+  double secs[NKERNELS], total = 0, s;
+  tCALIB cal;
+  int i, t;
+
+  calibrate (job, &cal);
+  for (i = 0; i < NKERNELS; i++)
+    {
+      nbins[i] = ntask[i] = 0;
+      secs[i] = 0;
+    }
+  if ((*job->cfg).plan >= 2)
+    printf ("%7s %7s %5s %12s %12s %10s %3s %-11s %10s\n", "task", "bin",
+	    "bins", "f (Hz)", "nfft", "segments", "L", "kernel", "s per bin");
+  for (t = 0; t < nrun; t++)
+    {
+      r = &job->run[t];
+      s = task_time (&cal, r);
+      nbins[r->kern] += r->count;
+      ntask[r->kern]++;
+      secs[r->kern] += s;
+      total += s;
+      if ((*job->cfg).plan >= 2)
+	printf ("%7d %7d %5d %12.5e %12lld %10lld %3d %-11s %10.3e\n", t,
+		r->first, r->count, (*data).fspec[r->first], r->nfft, r->nseg,
+		r->level, kernels[r->kern].name, s / r->count);
+    }
+  for (i = 0; i < NKERNELS; i++)
+    if (ntask[i] > 0)
+      printf ("Plan: %-11s %7d bin(s) in %7d task(s), predicted %9.3f s\n",
+	      kernels[i].name, nbins[i], ntask[i], secs[i]);
+  printf ("Plan: predicted %.3f s on %d thread(s)\n", total / nthreads,
+	  nthreads);
+}
+
+/*
+	spreads the frequency bins over a pool of worker threads by the
+	plan of plan_bins(): every task has its kernel and estimated cost,
+	which is also the cost the pool schedules by
+*/
 void
-calculate_lpsd (tCFG * cfg, tDATA * data)
+calculate_lpsd (tCFG * cfg, tDATA * data, const tDTIDX * dt)
 {
-  int k;			/* 0..nspec */
-  double rslt[4];		/* rslt[0]=PSD, rslt[1]=variance(PSD) rslt[2]=PS rslt[3]=variance(PS) */
-  double progress;
+  int nthreads;
+  double *cost;			/* estimated cost of every task */
+  tBINRUN *run;			/* tasks */
+  int nrun;			/* number of tasks */
+  tLPSDJOB job;
+  long hits, misses;		/* window cache statistics */
+  int ndec, maxlev;		/* number of decimated bins, deepest level */
+  int t;
 
   struct timeval tv;
-  double start, now, print;
+  double start;
+
+  job.cfg = cfg;
+  job.data = data;
+  job.dt = dt;
+  job.ncos = window_cosum (job.cw);
+
+  run = (tBINRUN *) xmalloc ((*cfg).nspec * sizeof (tBINRUN));
+  nrun = plan_bins (&job, run, &maxlev);
+  cost = (double *) xmalloc (nrun * sizeof (double));
+  for (t = ndec = 0; t < nrun; t++) {
+    cost[t] = run[t].cost;
+    if (run[t].level > 0)
+      ndec++;
+  }
+  nthreads = get_nthreads ((*cfg).nthreads);
+  job.run = run;
+  job.pyr = NULL;
+  if (maxlev > 0) {
+    printf ("Decimation for %d bin(s) down to level %d, %g dB stopband, "
+	    "passband ripple %.1e per level\n", ndec, maxlev,
+	    (*cfg).decatt, decimate_ripple ((*cfg).decatt));
+    job.pyr = pyramid_build (dt, maxlev, (*cfg).decatt, (*cfg).LR);
+    if (job.pyr->nlev <= maxlev)
+      gerror ("Time series too short for the decimation filters");
+  }
 
-  printf ("Computing output:  00.0%%");
+  wincache_init ((*cfg).wincache * 1048576.);
+  if ((*cfg).plan > 0)
+    print_plan (&job, nrun, nthreads);
+  printf ("Computing output on %d thread(s), %s kernel:  00.0%%", nthreads,
+	  dft_kernel_name ());
   fflush (stdout);
   gettimeofday (&tv, NULL);
   start = tv.tv_sec + tv.tv_usec / 1e6;
-  now = start;
-  print = start;
 
-  for (k = 0; k < (*cfg).nspec; k++)  {
+  run_tasks (nrun, cost, nthreads, lpsd_bin, &job, print_progress);
 
-    if (FAST)
-      getDFT2 ((*data).nffts[k], (*data).bins[k], (*cfg).fsamp, (*cfg).ovlp,
-	    (*cfg).LR, &rslt[0], &(*data).avg[k]);
-    else
-      getDFT ((*data).nffts[k], (*data).bins[k], (*cfg).fsamp, (*cfg).ovlp,
-	      (*cfg).LR, &rslt[0], &(*data).avg[k]);
-      
-    (*data).psd[k] = rslt[0];
-    (*data).varpsd[k] = rslt[1];
-    (*data).ps[k] = rslt[2];
-    (*data).varps[k] = rslt[3];
-    gettimeofday (&tv, NULL);
-    now = tv.tv_sec + tv.tv_usec / 1e6;
-      
-    if (now - print > PSTEP)  {
-      print = now;
-      progress = (100 * ((double) k)) / ((double) ((*cfg).nspec));
-      printf ("\b\b\b\b\b\b%5.1f%%", progress);
-      fflush (stdout);
+  /* finish */
+  printf ("\b\b\b\b\b\b  100%%\n");
+  fflush (stdout);
+  gettimeofday (&tv, NULL);
+  printf ("Duration (s)=%5.3f\n", tv.tv_sec - start + tv.tv_usec / 1e6);
+  wincache_stats (&hits, &misses);
+  printf ("Window tables: %ld computed, %ld reused\n\n", misses, hits);
+  wincache_free ();
+  pyramid_free (job.pyr);
+  xfree (run);
+  xfree (cost);
+}
+
+/*
+	detrended DFT V of the constant 1 in the segments of bin o: subtracting
+	d from the series changes the DFT X of every segment to X - d*V
+*/
+static void
+ooc_offset_dft (const tOOCBIN * o, int LR, double *v)
+{
+  double b;
+
+  if (LR == 1)
+    v[0] = v[1] = 0;		/* the regression takes out any constant */
+  else if (LR == 2)
+    {
+      b = 1 - 1 / (double) (o->nfft - 1.0);
+      v[0] = -b * o->w1re;
+      v[1] = -b * o->w1im;
+    }
+  else
+    {
+      v[0] = o->w0re;
+      v[1] = o->w0im;
+    }
+}
+
+/*
+	detrends the finished segment in slot r of bin o and adds its squared
+	magnitude to the bin's West average, like average_segments()
+	with blockmean, b = Re(X*conj(V)) is averaged along, so that the mean
+	of the series can be subtracted afterwards (ooc_submean())
+*/
+static void
+ooc_average (tOOCBIN * o, int r, int LR, int blockmean)
+{
+  double dft_re, dft_im;	/* real and imaginary part of DFT */
+  double a, b;			/* linear regression results */
+  double w0[2], w1[2];		/* DFT of window and of window times index */
+  double p, q, dp, dq, v[2];
+
+  w0[0] = o->w0re;
+  w0[1] = o->w0im;
+  w1[0] = o->w1re;
+  w1[1] = o->w1im;
+  if (LR == 1)
+    detrend_fit (o->sy[r], o->sty[r], o->nfft, &a, &b);
+  else if (LR == 2)
+    {
+      a = o->xa[r];
+      b = o->xb[r] - o->xa[r] / (double) (o->nfft - 1.0);
+    }
+  else
+    a = b = 0.0;
+  dft_re = o->re[r] - (a * w0[0] + b * w1[0]);
+  dft_im = o->im[r] - (a * w0[1] + b * w1[1]);
+  p = dft_re * dft_re + dft_im * dft_im;
+  if (blockmean)
+    {
+      /* co-moments updated like west_add() */
+      ooc_offset_dft (o, LR, v);
+      q = dft_re * v[0] + dft_im * v[1];
+      dp = p - o->west_m;
+      dq = q - o->west_b;
+      o->west_b += dq / (o->nsum + 1.);
+      o->west_tpb += dp * (q - o->west_b);
+      o->west_tbb += dq * (q - o->west_b);
+    }
+  west_add (p, &o->nsum, &o->west_m, &o->west_t);
+}
+
+/*
+	subtracts d from the series of bin o after all segments are averaged:
+	|X - d*V|^2 = |X|^2 - 2*d*b + d^2*|V|^2 with b = Re(X*conj(V))
+*/
+static void
+ooc_submean (tOOCBIN * o, int LR, double d)
+{
+  double v[2];
+
+  ooc_offset_dft (o, LR, v);
+  o->west_m += d * (d * (v[0] * v[0] + v[1] * v[1]) - 2 * o->west_b);
+  o->west_t += 4 * d * (d * o->west_tbb - o->west_tpb);
+}
+
+/*
+	advances one bin over the current block, called by the workers
+
+	Every segment that overlaps the block gets the DFT of its part in the
+	block, computed in pieces of TFBLOCK samples as in getDFT3(), and the
+	regression sums or end points of that part. Segments that end in the
+	block are averaged at once, in order, so at most nopen of them are
+	open at a time. W0, W1 and the window sums are accumulated while
+	segment 0 passes, before it is averaged.
+*/
+static void
+ooc_bin (int task, void *arg)
+{
+  tOOCJOB *job = (tOOCJOB *) arg;
+  tOOCBIN *o = &job->bin[task];
+  int LR = (*job->cfg).LR;
+  long long nfft = o->nfft;
+  long long b0 = job->b0, b1 = job->b0 + job->nb;
+  double *bcos, *bsin;		/* window*cos, window*(-sin) of one piece */
+  double *bwin;			/* window values of one piece */
+  const tWINTAB *wt = NULL;	/* cached window, if it fits into the budget */
+  const double *win;
+  double dft_re, dft_im;
+  long long s, st, p0, p1, j0;
+  int r, len, j;
+
+  if (o->next >= o->nseg || o->next * o->segOffset >= b1)
+    return;
+
+  bcos = (double *) xmalloc_align (DFT_ALIGN, TFBLOCK * sizeof (double));
+  bsin = (double *) xmalloc_align (DFT_ALIGN, TFBLOCK * sizeof (double));
+  bwin = (double *) xmalloc (TFBLOCK * sizeof (double));
+  if (nfft * sizeof (double) <= (*job->cfg).wincache * 1048576.)
+    wt = wincache_get (nfft);
+
+  for (s = o->next; s < o->nseg && (st = s * o->segOffset) < b1; s++)
+    {
+      r = (int) (s % o->nopen);
+      if (s == o->ninit)
+	{
+	  o->re[r] = o->im[r] = 0;
+	  o->sy[r].hi = o->sy[r].lo = o->sty[r].hi = o->sty[r].lo = 0;
+	  o->ninit++;
+	}
+      p0 = MAX (b0, st);
+      p1 = MIN (b1, st + nfft);
+
+      for (j0 = p0 - st; j0 < p1 - st; j0 += TFBLOCK)
+	{
+	  len = MIN (TFBLOCK, p1 - st - j0);
+	  if (wt)
+	    win = wt->win + j0;
+	  else
+	    {
+	      makewinpart (nfft, j0, len, bwin);
+	      if (s == 0)
+		for (j = 0; j < len; j++)
+		  {
+		    o->winsum += bwin[j];
+		    o->winsum2 += bwin[j] * bwin[j];
+		  }
+	      win = bwin;
+	    }
+	  phasor_fill (o->bin, nfft, j0, len, bcos, bsin);
+	  for (j = 0; j < len; j++)
+	    {
+	      bcos[j] = bcos[j] * win[j];
+	      bsin[j] = -bsin[j] * win[j];
+	    }
+	  if (s == 0)
+	    for (j = 0; j < len; j++)
+	      {
+		o->w0re += bcos[j];
+		o->w0im += bsin[j];
+		o->w1re += (long double) (j0 + j) * bcos[j];
+		o->w1im += (long double) (j0 + j) * bsin[j];
+	      }
+	  dft_dot (job->x + (st + j0 - b0), bcos, bsin, len, &dft_re, &dft_im);
+	  o->re[r] += dft_re;
+	  o->im[r] += dft_im;
+	}
+
+      if (LR == 1)
+	detrend_accum (job->dt, p0 - b0, p1 - p0, p0 - st, &o->sy[r],
+		       &o->sty[r]);
+      else if (LR == 2)
+	{
+	  if (st >= b0)
+	    o->xa[r] = job->x[st - b0];
+	  if (st + nfft <= b1)
+	    o->xb[r] = job->x[st + nfft - 1 - b0];
+	}
+
+      if (st + nfft <= b1)
+	{
+	  ooc_average (o, r, LR, job->blockmean);
+	  o->next = s + 1;
+	}
+    }
+
+  if (wt)
+    {
+      o->winsum = wt->winsum;
+      o->winsum2 = wt->winsum2;
+      wincache_release (wt);
+    }
+  xfree (bwin);
+  xfree (bsin);
+  xfree (bcos);
+}
+
+/*
+	out-of-core variant of calculate_lpsd() for time series larger than
+	the memory
+
+	The time series is read in blocks of (*cfg).oocmem MB by read_block(),
+	the blocks and their detrend indices are the only sample data in
+	memory. For every block, all bins advance over it on the worker
+	threads (ooc_bin()); the partial DFTs of segments that reach into the
+	next block and West's averages carry over. Every sample is read once,
+	sequentially, whatever the number of bins. Runs of bins are not
+	computed by FFT, and the sliding DFT and decimation are not used.
+
+	If (*data).blockmean is set, the mean of the selected samples is taken
+	in the same pass: the blocks are centered on the mean of the first
+	block, and the rest of the mean is subtracted from the averages of
+	every bin at the end (ooc_submean()).
+*/
+void
+calculate_lpsd_ooc (tCFG * cfg, tDATA * data)
+{
+  int k;			/* 0..nspec */
+  long long nread = (*data).nread;
+  int nthreads;
+  long long nb;			/* samples per block */
+  long long n, nblocks;
+  double *x;			/* current block */
+  double *cost;			/* estimated cost of every bin in a block */
+  double rslt[4];
+  tOOCBIN *bin, *o;
+  tOOCJOB job;
+  tDTIDX *dt;
+  long hits, misses;		/* window cache statistics */
+  double x0 = 0;		/* mean of the first block, with blockmean */
+  double xs;			/* mean of the centered samples */
+  tDD xsum = { 0, 0 };		/* sum of the centered samples */
+  long long i;
+
+  struct timeval tv;
+  double start;
+
+  /* samples plus their share of the detrend index */
+  nb = (long long) MIN ((double) nread, (*cfg).oocmem * 1048576.
+		  / (sizeof (double)
+		     + ((*cfg).LR == 1 ? 2 * sizeof (tDD) / DTSTEP : 0)));
+  nb = MAX (nb / DTSTEP * DTSTEP, MIN (nread, OOCMINBLOCK));
+  nblocks = (nread + nb - 1) / nb;
+
+  bin = (tOOCBIN *) xmalloc ((*cfg).nspec * sizeof (tOOCBIN));
+  cost = (double *) xmalloc ((*cfg).nspec * sizeof (double));
+  for (k = 0; k < (*cfg).nspec; k++)
+    {
+      o = &bin[k];
+      memset (o, 0, sizeof (tOOCBIN));
+      o->nfft = (*data).nffts[k];
+      o->bin = (*data).bins[k];
+      o->segOffset = segment_offset (o->nfft, (*cfg).ovlp);
+      o->nseg = (nread >= o->nfft) ? (nread - o->nfft) / o->segOffset + 1 : 1;
+      o->nopen = o->nfft / o->segOffset + 2;
+      o->re = (double *) xmalloc (o->nopen * sizeof (double));
+      o->im = (double *) xmalloc (o->nopen * sizeof (double));
+      o->sy = (tDD *) xmalloc (o->nopen * sizeof (tDD));
+      o->sty = (tDD *) xmalloc (o->nopen * sizeof (tDD));
+      o->xa = (double *) xmalloc (o->nopen * sizeof (double));
+      o->xb = (double *) xmalloc (o->nopen * sizeof (double));
+      cost[k] = (double) nb * o->nfft / o->segOffset;
+    }
+  x = (double *) xmalloc (nb * sizeof (double));
+
+  nthreads = get_nthreads ((*cfg).nthreads);
+  job.cfg = cfg;
+  job.bin = bin;
+  job.x = x;
+  job.blockmean = (*data).blockmean;
+  printf ("Out-of-core: %lld block(s) of %lld samples, no FFT runs, sliding DFT "
+	  "or decimation\n", nblocks, nb);
+  printf ("Computing output on %d thread(s), %s kernel:  00.0%%", nthreads,
+	  dft_kernel_name ());
+  fflush (stdout);
+  gettimeofday (&tv, NULL);
+  start = tv.tv_sec + tv.tv_usec / 1e6;
+
+  wincache_init ((*cfg).wincache * 1048576.);
+  for (job.b0 = 0; job.b0 < nread; job.b0 += nb)
+    {
+      n = MIN (nb, nread - job.b0);
+      read_block (x, job.b0, n);
+      if (job.blockmean)
+	{
+	  if (job.b0 == 0)
+	    {
+	      for (i = 0; i < n; i++)
+		x0 += x[i];
+	      x0 /= n;
+	    }
+	  for (i = 0; i < n; i++)
+	    {
+	      x[i] -= x0;
+	      dd_add_d (&xsum, x[i]);
+	    }
+	}
+      dt = ((*cfg).LR == 1) ? detrend_index (x, n, 1) : NULL;
+      job.nb = n;
+      job.dt = dt;
+      run_tasks ((*cfg).nspec, cost, nthreads, ooc_bin, &job, NULL);
+      detrend_free (dt);
+      print_progress ((double) (job.b0 + n) / nread);
+    }
+
+  if (job.blockmean)
+    {
+      xs = (xsum.hi + xsum.lo) / nread;
+      for (k = 0; k < (*cfg).nspec; k++)
+	ooc_submean (&bin[k], (*cfg).LR, xs);
+      (*data).mean = (x0 + xs) / (*cfg).ulsb;
+      (*data).blockmean = 0;
+    }
+  for (k = 0; k < (*cfg).nspec; k++)
+    {
+      o = &bin[k];
+      west_result (o->west_m, o->west_t, o->nsum, (*cfg).fsamp, o->winsum,
+		   o->winsum2, rslt);
+      (*data).psd[k] = rslt[0];
+      (*data).varpsd[k] = rslt[1];
+      (*data).ps[k] = rslt[2];
+      (*data).varps[k] = rslt[3];
+      (*data).avg[k] = o->nsum;
+      xfree (o->xb);
+      xfree (o->xa);
+      xfree (o->sty);
+      xfree (o->sy);
+      xfree (o->im);
+      xfree (o->re);
     }
 
-  }
   /* finish */
   printf ("\b\b\b\b\b\b  100%%\n");
   fflush (stdout);
   gettimeofday (&tv, NULL);
-  printf ("Duration (s)=%5.3f\n\n", tv.tv_sec - start + tv.tv_usec / 1e6);
+  printf ("Duration (s)=%5.3f\n", tv.tv_sec - start + tv.tv_usec / 1e6);
+  if (job.blockmean)
+    printf ("Mean of the selected samples: %.2e\n", (*data).mean);
+  wincache_stats (&hits, &misses);
+  printf ("Window tables: %ld computed, %ld reused\n\n", misses, hits);
+  wincache_free ();
+  xfree (x);
+  xfree (cost);
+  xfree (bin);
+}
+
+/*
+	averages the segments of one task, a contiguous range of segments,
+	with West's algorithm into the task's own accumulators; the segments
+	are detrended, windowed and transformed job->batch at a time by one
+	batched r2c FFT, the rest of the range one by one
+	with bands (METHOD 2) the mean periodogram of every band of a segment
+	is averaged instead of every bin
+*/
+static void
+welch_task (int task, void *arg)
+{
+  tWELCHJOB *job = (tWELCHJOB *) arg;
+  long long nfft = job->nfft;
+  long long nh = nfft / 2 + 1;	/* number of frequencies */
+  long long s0 = job->nseg * task / job->ntask;
+  long long s1 = job->nseg * (task + 1) / job->ntask;
+  double *m = job->m + task * job->nacc;
+  double *t = job->t + task * job->nacc;
+  double *in;			/* detrended, windowed segments */
+  fftw_complex *out, *o;
+  double *pw;			/* periodogram of one segment, per bin or band */
+  long long s, j, k, nsum;
+  int b, nb;
+  double d, west_q, west_r, west_sumw, west_rcp;
+
+  in = (double *) fftw_malloc (job->batch * nfft * sizeof (double));
+  out = (fftw_complex *) fftw_malloc (job->batch * nh * sizeof (fftw_complex));
+  if (in == NULL || out == NULL)
+    gerror ("Cannot allocate FFT buffers");
+  pw = (double *) xmalloc (job->nacc * sizeof (double));
+
+  nsum = 0;
+  for (s = s0; s < s1; s += nb)
+    {
+      nb = (s1 - s < job->batch) ? s1 - s : job->batch;
+      for (b = 0; b < nb; b++)
+	{
+	  remove_drift (in + b * nfft, job->dt, (s + b) * job->segOffset, nfft,
+			job->LR);
+	  for (j = 0; j < nfft; j++)
+	    in[b * nfft + j] *= job->dwin[j];
+	}
+      if (nb == job->batch)
+	fftw_execute_dft_r2c (job->plan->plan, in, out);
+      else
+	for (b = 0; b < nb; b++)
+	  fftw_execute_dft_r2c (job->plan1->plan, in + b * nfft, out + b * nh);
+
+      /* West's update, one division per segment */
+      for (b = 0; b < nb; b++, nsum++)
+	{
+	  o = out + b * nh;
+	  if (job->nband == 0)
+	    for (j = 0; j < nh; j++)
+	      pw[j] = 2 * (o[j][0] * o[j][0] + o[j][1] * o[j][1]);
+	  else
+	    for (j = 0; j < job->nband; j++)
+	      {
+		d = 0;
+		for (k = job->k0[j]; k < job->k0[j + 1]; k++)
+		  d += o[k][0] * o[k][0] + o[k][1] * o[k][1];
+		pw[j] = 2 * d / (double) (job->k0[j + 1] - job->k0[j]);
+	      }
+	  if (nsum == 0)
+	    {
+	      for (j = 0; j < job->nacc; j++)
+		{
+		  m[j] = pw[j];
+		  t[j] = 0;
+		}
+	      continue;
+	    }
+	  west_sumw = (double) nsum;
+	  west_rcp = 1. / (west_sumw + 1.);
+	  for (j = 0; j < job->nacc; j++)
+	    {
+	      d = pw[j];
+	      west_q = d - m[j];
+	      west_r = west_q * west_rcp;
+	      m[j] += west_r;
+	      t[j] += west_r * west_sumw * west_q;
+	    }
+	}
+    }
+  job->n[task] = nsum;
+
+  xfree (pw);
+  fftw_free (out);
+  fftw_free (in);
+}
+
+/*
+	METHOD 2: splits the FFT bins between fmin and fmax into nspec bands
+	equally spaced on a logarithmic axis; empty bands are dropped, band j
+	holds the bins (*k0)[j] <= k < (*k0)[j+1]; returns the number of bands
+*/
+static int
+log_bands (const tCFG * cfg, long long nh, long long **k0)
+{
+  long long kmin, kmax, k;
+  double lf;
+  int i, n = 0;
+
+  if ((*cfg).fmin <= 0 || (*cfg).nspec < 1)
+    gerror ("METHOD 2 needs fmin > 0 and at least one band");
+  kmin = MAX ((long long) ceil ((*cfg).fmin / (*cfg).fres - 1e-9),
+	      (long long) ceil ((*cfg).sbin));
+  kmax = MIN ((long long) floor ((*cfg).fmax / (*cfg).fres + 1e-9), nh - 1);
+  if (kmin > kmax)
+    gerror ("No FFT bin between fmin and fmax");
+
+  *k0 = (long long *) xmalloc (((*cfg).nspec + 1) * sizeof (long long));
+  (*k0)[0] = kmin;
+  lf = log ((*cfg).fmax / (*cfg).fmin) / (*cfg).nspec;
+  for (i = 1; i <= (*cfg).nspec; i++)
+    {
+      /* first bin of the next band */
+      k = kmax + 1;
+      if (i < (*cfg).nspec)
+	k = MIN (k, (long long) ceil ((*cfg).fmin * exp (i * lf)
+				      / (*cfg).fres - 1e-9));
+      if (k > (*k0)[n])
+	(*k0)[++n] = k;
+    }
+  return n;
+}
+
+/*
+	correlation of the periodogram of white noise at bins k apart,
+	rho_k = |DFT of w^2 at k| / sum w^2; returns the sums of rho_k^2 and
+	of k*rho_k^2 over k = 1..j in s1[j], s2[j] for j < nfft/2+1
+*/
+static void
+bin_correlation (const tWELCHJOB * job, double *s1, double *s2)
+{
+  long long nfft = job->nfft, nh = nfft / 2 + 1, j;
+  double *w2;
+  fftw_complex *c;
+  double sw2 = 0, r;
+
+  w2 = (double *) fftw_malloc (nfft * sizeof (double));
+  c = (fftw_complex *) fftw_malloc (nh * sizeof (fftw_complex));
+  if (w2 == NULL || c == NULL)
+    gerror ("Cannot allocate FFT buffers");
+  for (j = 0; j < nfft; j++)
+    {
+      w2[j] = job->dwin[j] * job->dwin[j];
+      sw2 += w2[j];
+    }
+  fftw_execute_dft_r2c (job->plan1->plan, w2, c);
+
+  s1[0] = s2[0] = 0;
+  for (j = 1; j < nh; j++)
+    {
+      r = (c[j][0] * c[j][0] + c[j][1] * c[j][1]) / (sw2 * sw2);
+      s1[j] = s1[j - 1] + r;
+      s2[j] = s2[j - 1] + j * r;
+    }
+  fftw_free (c);
+  fftw_free (w2);
+}
+
+/*
+	equivalent number of uncorrelated segments of nseg overlapping
+	segments (Welch): the periodograms of white noise in segments j apart
+	correlate with (sum w[n]*w[n+j*segOffset] / sum w^2)^2
+*/
+static double
+segment_equivalent (const tWELCHJOB * job, long long nseg)
+{
+  long long nfft = job->nfft, D = job->segOffset, j, i;
+  double sw2 = 0, c, denom = 1;
+
+  for (i = 0; i < nfft; i++)
+    sw2 += job->dwin[i] * job->dwin[i];
+  for (j = 1; j < nseg && j * D < nfft; j++)
+    {
+      c = 0;
+      for (i = 0; i + j * D < nfft; i++)
+	c += job->dwin[i] * job->dwin[i + j * D];
+      c /= sw2;
+      denom += 2 * (1 - (double) j / nseg) * c * c;
+    }
+  return nseg / denom;
 }
 
+/*
+	METHOD 2: results of the bands from the merged averages of calculate_fftw()
+	frequency and bin are the centre of the band, the RBW its width, the
+	deviations are those of the band mean over the segments, or with one
+	segment the expected ones; the number of averages is the equivalent
+	number of uncorrelated periodogram values, segments times bins, with
+	the overlap of the segments and the leakage between the bins
+*/
+static void
+band_results (tCFG * cfg, tDATA * data, const tWELCHJOB * job,
+	      long long navg, double winsum, double winsum2)
+{
+  long long nh = job->nfft / 2 + 1, nb;
+  double *s1, *s2;
+  double keq, beq, m, sd;
+  int j;
+
+  s1 = (double *) xmalloc (nh * sizeof (double));
+  s2 = (double *) xmalloc (nh * sizeof (double));
+  bin_correlation (job, s1, s2);
+  keq = segment_equivalent (job, navg);
+
+  for (j = 0; j < job->nband; j++)
+    {
+      nb = job->k0[j + 1] - job->k0[j];
+      beq = nb / (1 + 2 * (s1[nb - 1] - s2[nb - 1] / nb));
+      m = job->m[j];
+      sd = (navg > 1) ? sqrt (job->t[j] / ((double) navg - 1)) : m / sqrt (beq);
+      (*data).bins[j] = (job->k0[j] + job->k0[j + 1] - 1) / 2.;
+      (*data).fspec[j] = (*cfg).fres * (*data).bins[j];
+      (*data).rbw[j] = (*cfg).fres * nb;
+      (*data).nffts[j] = job->nfft;
+      (*data).avg[j] = llround (keq * beq);
+      (*data).ps[j] = m / (winsum * winsum);
+      (*data).varps[j] = sd / (winsum * winsum);
+      (*data).psd[j] = m / ((*cfg).fsamp * winsum2);
+      (*data).varpsd[j] = sd / ((*cfg).fsamp * winsum2);
+    }
+  (*cfg).nspec = job->nband;
+
+  xfree (s2);
+  xfree (s1);
+}
+
+/*
+	Welch's method with one FFT length nfft = cfg.nfft
+
+	The segments are split into contiguous ranges, one task of the thread
+	pool each, that keep their own West averages (welch_task()). The tasks
+	are merged in order with Chan's update of mean and sum of squares,
+	so the result does not depend on the number of threads beyond rounding.
+
+	METHOD 2 averages the bins of every segment in nspec logarithmically
+	spaced bands while it streams by (log_bands()), the tasks only keep
+	the bands, and writes one line per band (band_results()).
+*/
 void
-calculate_fftw (tCFG * cfg, tDATA * data)
+calculate_fftw (tCFG * cfg, tDATA * data, const tDTIDX * dt)
 {
-  int nfft;			/* dimension of DFT */
-  FILE *wfp;
-  fftw_plan plan;
-  double *rawdata;		/* start address of data */
-  double *out;
-  double *segm;			/* contains data of one segment without drift */
-  int i, j;
-  double d;
-  int start;
-  double *west_sumw;
-  double west_q, west_r, west_temp;
-  int navg;
-  double *fft_ps, *fft_varps;
+  long long nfft;		/* dimension of DFT */
+  long long nh;			/* number of frequencies */
+  tWELCHJOB job;
+  double *dwin;			/* window function for FFT */
+  double *cost;
+  long long *k0 = NULL;		/* bands of METHOD 2 */
+  long long i, j;
+  long long navg, nb;
+  double delta, fa, fb;
+  int task, nthreads;
+  long long nread = (*data).nread;
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  double nenbw;			/* normalized equivalent noise bandwidth */
 
   struct timeval tv;
   double stt;
@@ -584,127 +2291,102 @@ calculate_fftw (tCFG * cfg, tDATA * data)
   stt = tv.tv_sec + tv.tv_usec / 1e6;
 
   nfft = (*cfg).nfft;
+  nh = nfft / 2 + 1;
+
+  /* segments and tasks */
+  job.dt = dt;
+  job.nfft = nfft;
+  job.LR = (*cfg).LR;
+  job.segOffset = MAX (1, (long long) (nfft * (1.0 - (double) ((*cfg).ovlp / 100.))));
+  job.nseg = 1;
+  if (nread > nfft)
+    job.nseg += (nread - nfft - 1) / job.segOffset;
+  nthreads = get_nthreads ((*cfg).nthreads);
+  job.ntask = (int) MIN ((long long) nthreads, job.nseg);
+  job.batch = (int) MIN ((long long) WELCHBATCH,
+			 (job.nseg + job.ntask - 1) / job.ntask);
+  job.batch = (int) MAX (1LL, MIN ((long long) job.batch,
+				   (long long) (WELCHMEM / (8. * nfft))));
+
+  job.nband = 0;
+  job.nacc = nh;
+  if ((*cfg).METHOD == 2)
+    {
+      job.nband = log_bands (cfg, nh, &k0);
+      job.nacc = job.nband;
+    }
+  job.k0 = k0;
 
   dwin = (double *) xmalloc (nfft * sizeof (double));
-  segm = (double *) xmalloc (nfft * sizeof (double));
-  out = (double *) xmalloc (nfft * sizeof (double));
-  west_sumw = (double *) xmalloc ((nfft / 2 + 1) * sizeof (double));
-  fft_ps = (double *) xmalloc ((nfft / 2 + 1) * sizeof (double));
-  fft_varps = (double *) xmalloc ((nfft / 2 + 1) * sizeof (double));
+  job.m = (double *) xmalloc (job.ntask * job.nacc * sizeof (double));
+  job.t = (double *) xmalloc (job.ntask * job.nacc * sizeof (double));
+  job.n = (long long *) xmalloc (job.ntask * sizeof (long long));
+  cost = (double *) xmalloc (job.ntask * sizeof (double));
 
   /* calculate window function */
   makewin (nfft, 0, dwin, &winsum, &winsum2, &nenbw);
+  job.dwin = dwin;
 
-  /* import fftw "wisdom" */
-  if ((wfp = fopen ((*cfg).wfn, "r")) == NULL)
-    message1 ("Cannot open '%s'", (*cfg).wfn);
-  else  {
-    if (fftw_import_wisdom_from_file (wfp) == 0)
-	    message ("Error importing wisdom");
-      fclose (wfp);
-  }
   /* plan DFT */
   printf ("Planning...");
   fflush (stdout);
 
-  plan = fftw_plan_r2r_1d (nfft, segm, out, FFTW_R2HC, FFTW_ESTIMATE);
+  job.plan = fftplan_get (FP_R2C, nfft, job.batch, 0);
+  job.plan1 = fftplan_get (FP_R2C, nfft, 1, FFTW_UNALIGNED);
   printf ("done.\n");
   fflush (stdout);
 
-  rawdata = get_data ();
-  assert (rawdata != 0);
-
-  printf ("Computing output\n");
-
-  /* remove drift from first data segment */
-  remove_drift (&segm[0], &rawdata[0], nfft, (*cfg).LR);
-  /* multiply data with window function */
-  for (i = 0; i < nfft; i++)
-    segm[i] = segm[i] * dwin[i];
-
-  fftw_execute (plan);
-
-  d = 2 * (out[0] * out[0]);
-
-  (*data).fft_ps[0] = d;
-  west_sumw[0] = 1.;
-  (*data).fft_varps[0] = 0;
-  for (j = 1; j < nfft / 2 + 1; j++)  {
-    d = 2 * (out[j] * out[j] + out[nfft - j] * out[nfft - j]);
-    (*data).fft_ps[j] = d;
-    west_sumw[j] = 1.;
-    (*data).fft_varps[j] = 0;
-  }
-
-  navg = 1;
-  start = nfft * (1.0 - (double) ((*cfg).ovlp / 100.));
-
-  /* remaining segments */
-  while (start + nfft < nread)  {
-    printf (".");
-    fflush (stdout);
-    if (navg % 75 == 0)
-	    printf ("\n");
-
-  navg++;
-  remove_drift (&segm[0], &rawdata[start], nfft, (*cfg).LR);
+  printf ("Computing output on %d thread(s), %lld segments, %d per FFT batch:"
+	  "  00.0%%", nthreads, job.nseg, job.batch);
+  fflush (stdout);
+  for (task = 0; task < job.ntask; task++)
+    cost[task] = (double) (job.nseg * (task + 1) / job.ntask
+			   - job.nseg * task / job.ntask);
+  run_tasks (job.ntask, cost, nthreads, welch_task, &job, print_progress);
+  printf ("\b\b\b\b\b\b  100%%\n");
 
-  /* multiply data with window function */
-  for (i = 0; i < nfft; i++)
-  	segm[i] = segm[i] * dwin[i];
-
-    fftw_execute (plan);
-
-    d = 2 * (out[0] * out[0]);
-    west_q = d - (*data).fft_ps[0];
-    west_temp = west_sumw[0] + 1;
-    west_r = west_q / west_temp;
-    (*data).fft_ps[0] += west_r;
-    (*data).fft_varps[0] += west_r * west_sumw[0] * west_q;
-    west_sumw[0] = west_temp;
-
-    for (j = 1; j < nfft / 2 + 1; j++)  {
-  	  d = 2 * (out[j] * out[j] + out[nfft - j] * out[nfft - j]);
-      west_q = d - (*data).fft_ps[j];
-      west_temp = west_sumw[j] + 1;
-      west_r = west_q / west_temp;
-      (*data).fft_ps[j] += west_r;
-      (*data).fft_varps[j] += west_r * west_sumw[j] * west_q;
-      west_sumw[j] = west_temp;
+  /* merge the tasks in order, Chan et al.'s pairwise update */
+  navg = job.n[0];
+  for (task = 1; task < job.ntask; task++)  {
+    nb = job.n[task];
+    fa = (double) nb / (double) (navg + nb);
+    fb = (double) navg * fa;
+    for (j = 0; j < job.nacc; j++)  {
+      delta = job.m[task * job.nacc + j] - job.m[j];
+      job.m[j] += delta * fa;
+      job.t[j] += job.t[task * job.nacc + j] + delta * delta * fb;
     }
-
-    start += nfft * (1.0 - (double) ((*cfg).ovlp / 100.));	/* go to next segment */
-  } //end-while loop over remaning segments
-
-  if (navg > 1) {
-    
-    for (i = 0; i < nfft / 2 + 1; i++)  {
-	  (*data).fft_varps[i] = sqrt ((*data).fft_varps[i] / ((double) navg - 1));
-	  }
+    navg += nb;
   }
-  else  {
 
-    for (i = 0; i < nfft / 2 + 1; i++)  {
-	    (*data).fft_varps[i] = (*data).fft_ps[i];
-	  }
-  }
-  /* normalizations and additional information */
-  j = 0;
-  for (i = 0; i < nfft / 2 + 1; i++)  {
-
-    if (((*cfg).fres * i >= (*cfg).fmin) &&
-	      ((*cfg).fres * i <= (*cfg).fmax) && ((*cfg).sbin <= i))
-	  {
-	    (*data).fspec[j] = (*cfg).fres * i;
-	    (*data).ps[j] = (*data).fft_ps[i] / (winsum * winsum);
-      (*data).varps[j] = (*data).fft_varps[i] / (winsum * winsum);
-      (*data).psd[j] = (*data).fft_ps[i] / ((*cfg).fsamp * winsum2);
-      (*data).varpsd[j] = (*data).fft_varps[i] / ((*cfg).fsamp * winsum2);
-      (*data).avg[j] = navg;
-      (*data).nffts[j] = nfft;
-      (*data).bins[j] = (double) i;
-      j++;
-	  }
+  if (job.nband > 0)
+    band_results (cfg, data, &job, navg, winsum, winsum2);
+  else  {
+    for (i = 0; i < nh; i++)  {
+      (*data).fft_ps[i] = job.m[i];
+      if (navg > 1)
+        (*data).fft_varps[i] = sqrt (job.t[i] / ((double) navg - 1));
+      else
+        (*data).fft_varps[i] = job.m[i];
+    }
+    /* normalizations and additional information */
+    j = 0;
+    for (i = 0; i < nh; i++)  {
+
+      if (((*cfg).fres * i >= (*cfg).fmin) &&
+	        ((*cfg).fres * i <= (*cfg).fmax) && ((*cfg).sbin <= i))
+	    {
+	      (*data).fspec[j] = (*cfg).fres * i;
+	      (*data).ps[j] = (*data).fft_ps[i] / (winsum * winsum);
+        (*data).varps[j] = (*data).fft_varps[i] / (winsum * winsum);
+        (*data).psd[j] = (*data).fft_ps[i] / ((*cfg).fsamp * winsum2);
+        (*data).varpsd[j] = (*data).fft_varps[i] / ((*cfg).fsamp * winsum2);
+        (*data).avg[j] = navg;
+        (*data).nffts[j] = nfft;
+        (*data).bins[j] = (double) i;
+        j++;
+	    }
+    }
   }
 
   printf ("done.\n");
@@ -712,24 +2394,16 @@ calculate_fftw (tCFG * cfg, tDATA * data)
   gettimeofday (&tv, NULL);
   printf ("Duration (s)=%5.3f\n\n", tv.tv_sec - stt + tv.tv_usec / 1e6);
 
-  /* write wisdom to file */
-  if ((wfp = fopen ((*cfg).wfn, "w")) == NULL)
-    message1 ("Cannot open '%s'", (*cfg).wfn);
-  else  {
-    fftw_export_wisdom_to_file (wfp);
-    fclose (wfp);
-  }
   /* clean up */
-  fftw_destroy_plan (plan);
-
-  /* forget wisdom, free memory */
-  fftw_forget_wisdom ();
-  xfree (fft_ps);
-  xfree (fft_varps);
-  xfree (west_sumw);
+  fftplan_release (job.plan1);
+  fftplan_release (job.plan);
+  if (k0 != NULL)
+    xfree (k0);
+  xfree (cost);
+  xfree (job.n);
+  xfree (job.t);
+  xfree (job.m);
   xfree (dwin);
-  xfree (segm);
-  xfree (out);
 } //end-of calculate_fftw()
 
 /*
@@ -738,21 +2412,47 @@ calculate_fftw (tCFG * cfg, tDATA * data)
 void
 calculateSpectrum (tCFG * cfg, tDATA * data)
 {
-  nread = (*data).nread;
+  static const char *smpnames[] = { "float64", "float32", "int32", "int16" };
+  tDTIDX *dt;
+  const void *raw;
+  int type;
+  long hits, misses;		/* plan cache statistics */
 
-  /* read data file into memory */
+  /* select the data loaded by probe_file() between tmin and tmax */
   /* and subtract mean data value */
-  printf ("\nReading data, subtracting mean...\n");
-  nread = floor (((*cfg).tmax - (*cfg).tmin) * (*cfg).fsamp + 1);
-  read_file ((*cfg).ifn, (*cfg).ulsb, (*data).mean,
-	          (int) ((*cfg).tmin * (*cfg).fsamp), (*data).nread,
-	          (*data).comma);
+  printf ("\nSelecting data, subtracting mean...\n");
+  read_file ((*cfg).ulsb, (*data).mean,
+	     (long long) ((*cfg).tmin * (*cfg).fsamp), (*data).nread);
+  if ((*cfg).oocmem > 0) {
+    if ((*cfg).METHOD != 0)
+      gerror ("Out-of-core mode (OOCMEM) needs METHOD 0");
+    calc_params (cfg, data);
+    calculate_lpsd_ooc (cfg, data);
+    return;
+  }
+  /* prefix sums for the linear regression of all segments */
+  raw = get_compact (&type);
+  if (raw != NULL) {
+    printf ("Keeping the %s samples, mean and scaling applied in the kernels\n",
+	    smpnames[type]);
+    dt = detrend_index_raw (raw, type, (*cfg).ulsb, (*data).mean,
+			    (*data).nread, (*cfg).LR);
+  }
+  else
+    dt = detrend_index (get_data (), (*data).nread, (*cfg).LR);
 
+  fftplan_init ((*cfg).wfn, (*cfg).rigor);
   if ((*cfg).METHOD == 0) {
     calc_params (cfg, data);
-    calculate_lpsd (cfg, data);
+    calculate_lpsd (cfg, data, dt);
   }
-  else if ((*cfg).METHOD == 1)  {
-      calculate_fftw (cfg, data);
+  else if ((*cfg).METHOD == 1 || (*cfg).METHOD == 2)  {
+      calculate_fftw (cfg, data, dt);
   }
+  fftplan_stats (&hits, &misses);
+  if (hits + misses > 0)
+    printf ("FFT plans (%s): %ld made, %ld reused\n\n", (*cfg).rigor, misses,
+	    hits);
+  fftplan_free ();
+  detrend_free (dt);
 } //end-of calculateSpectrum()
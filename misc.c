@@ -4,20 +4,45 @@
 #include "errors.h"
 #include "misc.h"
 
-static int nallocs=0;
+static int nallocs=0;			/* updated atomically, xmalloc is called from worker threads */
 
 void *xmalloc(size_t size) {
 	void *value;
 
 	value = malloc (size);
-	nallocs++;
+	__sync_fetch_and_add(&nallocs, 1);
 
 	if (value == 0) gerror ("\nerror in xmalloc\n");
 	return value;
 }
 
+/*
+	allocates size bytes aligned to align bytes (a power of two, multiple
+	of sizeof(void *)), e.g. for SIMD loads; release with xfree
+*/
+void *xmalloc_align(size_t align, size_t size) {
+	void *value = 0;
+
+	if (posix_memalign (&value, align, size ? size : 1) != 0) value = 0;
+	__sync_fetch_and_add(&nallocs, 1);
+
+	if (value == 0) gerror ("\nerror in xmalloc_align\n");
+	return value;
+}
+
+/* resizes a block from xmalloc to size bytes, the contents are kept */
+void *xrealloc(void *p, size_t size) {
+	void *value;
+
+	if (p == 0) return xmalloc(size);
+	value = realloc (p, size ? size : 1);
+
+	if (value == 0) gerror ("\nerror in xrealloc\n");
+	return value;
+}
+
 void xfree(void *p) {
-	nallocs--;
+	__sync_fetch_and_sub(&nallocs, 1);
 	free(p);
 }
 
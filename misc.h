@@ -2,6 +2,8 @@
 #define __misc_h
 
 void *xmalloc(size_t size);
+void *xmalloc_align(size_t align, size_t size);
+void *xrealloc(void *p, size_t size);
 void xfree(void *p);
 inline double dMax  ( double x, double y );
 //int round (double x);
@@ -0,0 +1,88 @@
+/********************************************************************************
+    phasor.c
+
+    generates cos and sin of the DFT kernel exp(i*2*pi*bin*j/nfft) for a
+    block of consecutive sample indices j without calling sin() and cos()
+    for every sample
+
+    PH_LANES phasors, one for each of the indices j0, j0+1, ..., j0+PH_LANES-1,
+    are advanced together by a complex multiplication with
+    exp(i*2*pi*bin*PH_LANES/nfft). The lanes are independent, so the compiler
+    turns the rotation into SIMD instructions. Every PH_RESEED samples the
+    phasors are re-seeded from sin() and cos() of the exact phase of the
+    first lane, times the fixed offsets exp(i*2*pi*bin*l/nfft) of lane l.
+
+    The phase bin*j/nfft is reduced modulo 1 before it is multiplied by 2*pi:
+    bin*j is split into a rounded product and its exact error (fma), the
+    product is reduced exactly by fmod(). The seeds are therefore accurate
+    to a few ulp for any j < 2^53, i.e. for any nfft of a 64-bit index.
+    Between seeds, the rounding errors of PH_RESEED/PH_LANES rotations add
+    up to an absolute error of a few 1e-14.
+ ********************************************************************************/
+#include <math.h>
+#include "phasor.h"
+
+/* c + i*s = exp(i*2*pi*frac(bin*j/nfft)) */
+static void
+phase_of (double bin, long long nfft, double j, double *c, double *s)
+{
+  double hi, lo, r, arg;
+
+  hi = bin * j;
+  lo = fma (bin, j, -hi);	/* bin*j = hi + lo exactly */
+  r = fmod (hi, (double) nfft) + lo;
+  if (r < 0)
+    r += nfft;
+  else if (r >= nfft)
+    r -= nfft;
+  arg = 2.0 * M_PI * (r / (double) nfft);
+  *c = cos (arg);
+  *s = sin (arg);
+}
+
+/*
+	c[k] = cos(2*pi*bin*(j0+k)/nfft)
+	s[k] = sin(2*pi*bin*(j0+k)/nfft)	for k = 0..n-1
+*/
+void
+phasor_fill (double bin, long long nfft, long long j0, long long n, double *c,
+	     double *s)
+{
+  double zc[PH_LANES], zs[PH_LANES];	/* one phasor per lane */
+  double lc[PH_LANES], ls[PH_LANES];	/* offset of every lane */
+  double c0, s0;			/* exact seed of the first lane */
+  double rc, rs;			/* rotation by PH_LANES samples */
+  double tc;
+  long long k;
+  int l, m, len;
+
+  phase_of (bin, nfft, PH_LANES, &rc, &rs);
+  for (l = 0; l < PH_LANES; l++)
+    phase_of (bin, nfft, l, &lc[l], &ls[l]);
+  for (k = 0; k < n; k += PH_RESEED)
+    {
+      len = (n - k < PH_RESEED) ? n - k : PH_RESEED;
+      phase_of (bin, nfft, (double) (j0 + k), &c0, &s0);
+      for (l = 0; l < PH_LANES; l++)
+	{
+	  zc[l] = c0 * lc[l] - s0 * ls[l];
+	  zs[l] = s0 * lc[l] + c0 * ls[l];
+	}
+      for (m = 0; m + PH_LANES <= len; m += PH_LANES)
+	{
+	  for (l = 0; l < PH_LANES; l++)
+	    {
+	      c[k + m + l] = zc[l];
+	      s[k + m + l] = zs[l];
+	      tc = zc[l] * rc - zs[l] * rs;
+	      zs[l] = zs[l] * rc + zc[l] * rs;
+	      zc[l] = tc;
+	    }
+	}
+      for (l = 0; m + l < len; l++)
+	{
+	  c[k + m + l] = zc[l];
+	  s[k + m + l] = zs[l];
+	}
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef __phasor_h
+#define __phasor_h
+
+#define PH_LANES 8		/* phasors advanced in parallel */
+#define PH_RESEED 512		/* samples between exact re-seeds, multiple of PH_LANES */
+
+void phasor_fill (double bin, long long nfft, long long j0, long long n,
+		  double *c, double *s);
+
+#endif
@@ -0,0 +1,270 @@
+/********************************************************************************
+    scandbl.c
+
+    converts a decimal number in a line of text to double without copying
+    the line, giving exactly the value strtod() would return
+
+    The digits are accumulated into a 64-bit mantissa w and a decimal
+    exponent q, value = w * 10^q. If w < 2^53 and |q| <= 22, w and 10^|q|
+    are exact doubles and one multiplication or division rounds correctly
+    (Clinger's fast path). Otherwise, the Eisel-Lemire algorithm multiplies
+    the normalized w with a 128-bit truncated mantissa of 10^q and rounds
+    the upper bits; if the truncated low bits could decide the rounding,
+    it gives up. Numbers it cannot handle (more than 19 significant digits,
+    subnormal or out of range results, halfway cases, inf, nan, hex) are
+    passed to strtod() on a copy of the field.
+
+    The table of the 128-bit mantissas of 10^q is computed once with exact
+    multi-word arithmetic: 5^q for q >= 0, floor(2^K / 5^-q) for q < 0.
+
+    If comma is nonzero, ',' is a decimal point as well as '.'.
+ ********************************************************************************/
+#include <stdlib.h>
+#include <stdint.h>
+#include <float.h>
+#include <string.h>
+#include <pthread.h>
+#include "scandbl.h"
+
+#define QMIN (-348)		/* range of decimal exponents in the table */
+#define QMAX 347
+#define BIGW 34			/* 32-bit words of the multi-word numbers */
+#define MAXFIELD 400		/* longest field passed to strtod() */
+
+static uint64_t pow10hi[QMAX - QMIN + 1];	/* 128-bit mantissas of 10^q */
+static uint64_t pow10lo[QMAX - QMIN + 1];
+static pthread_once_t table_once = PTHREAD_ONCE_INIT;
+
+#if FLT_EVAL_METHOD == 0
+/* powers of ten that are exact doubles, for Clinger's fast path */
+static const double exact10[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
+
+/* the 128 bits of v[0..BIGW-1] below and including its highest set bit */
+static void
+top128 (const uint32_t * v, uint64_t * hi, uint64_t * lo)
+{
+  int b, i, j;
+
+  for (b = 32 * BIGW - 1; b >= 0 && !(v[b / 32] >> (b % 32) & 1); b--);
+  *hi = *lo = 0;
+  for (i = 0; i < 128; i++)
+    {
+      j = b - i;
+      if (j >= 0 && (v[j / 32] >> (j % 32) & 1))
+	{
+	  if (i < 64)
+	    *hi |= (uint64_t) 1 << (63 - i);
+	  else
+	    *lo |= (uint64_t) 1 << (127 - i);
+	}
+    }
+}
+
+static void
+make_table (void)
+{
+  uint32_t v[BIGW];
+  uint64_t r;
+  int q, i;
+
+  /* 5^q, q = 0..QMAX */
+  memset (v, 0, sizeof (v));
+  v[0] = 1;
+  for (q = 0; q <= QMAX; q++)
+    {
+      top128 (v, &pow10hi[q - QMIN], &pow10lo[q - QMIN]);
+      for (i = 0, r = 0; i < BIGW; i++)
+	{
+	  r += (uint64_t) v[i] * 5;
+	  v[i] = (uint32_t) r;
+	  r >>= 32;
+	}
+    }
+
+  /* floor(2^K / 5^-q), q = -1..QMIN, K = 32*BIGW-1 */
+  memset (v, 0, sizeof (v));
+  v[BIGW - 1] = 0x80000000u;
+  for (q = -1; q >= QMIN; q--)
+    {
+      for (i = BIGW - 1, r = 0; i >= 0; i--)
+	{
+	  r = (r << 32) | v[i];
+	  v[i] = (uint32_t) (r / 5);
+	  r %= 5;
+	}
+      top128 (v, &pow10hi[q - QMIN], &pow10lo[q - QMIN]);
+    }
+}
+
+/* leading zero bits of w > 0 */
+static int
+clz64 (uint64_t w)
+{
+  int n = 0;
+
+  for (; !(w >> 63); w <<= 1)
+    n++;
+  return n;
+}
+
+/*
+	w * 10^q correctly rounded to *x for w > 0 by the Eisel-Lemire algorithm
+	returns 0 if the result is not certain or not a normal double
+*/
+static int
+eisel_lemire (uint64_t w, int q, int neg, double *x)
+{
+  unsigned __int128 p;
+  uint64_t xhi, xlo, yhi, ylo, mhi, mlo, mant, msb, bits;
+  int64_t e2;
+  int lz;
+
+  if (q < QMIN || q > QMAX)
+    return 0;
+  lz = clz64 (w);
+  w <<= lz;
+  /* 217706/2^16 = log2(10) */
+  e2 = (int64_t) ((217706 * q) >> 16) + 64 + 1023 - lz;
+
+  p = (unsigned __int128) w * pow10hi[q - QMIN];
+  xhi = (uint64_t) (p >> 64);
+  xlo = (uint64_t) p;
+  /* the low word of 10^q may carry into the bits to be rounded */
+  if ((xhi & 0x1FF) == 0x1FF && xlo + w < w)
+    {
+      p = (unsigned __int128) w * pow10lo[q - QMIN];
+      yhi = (uint64_t) (p >> 64);
+      ylo = (uint64_t) p;
+      mhi = xhi;
+      mlo = xlo + yhi;
+      if (mlo < xlo)
+	mhi++;
+      if ((mhi & 0x1FF) == 0x1FF && mlo + 1 == 0 && ylo + w < w)
+	return 0;
+      xhi = mhi;
+      xlo = mlo;
+    }
+
+  /* 54 bits */
+  msb = xhi >> 63;
+  mant = xhi >> (msb + 9);
+  e2 -= 1 ^ msb;
+
+  /* exactly halfway or not? the truncated bits can't tell */
+  if (xlo == 0 && (xhi & 0x1FF) == 0 && (mant & 3) == 1)
+    return 0;
+
+  /* round to 53 bits */
+  mant += mant & 1;
+  mant >>= 1;
+  if (mant >> 53)
+    {
+      mant >>= 1;
+      e2++;
+    }
+  if (e2 <= 0 || e2 >= 0x7FF)
+    return 0;
+  bits = (uint64_t) e2 << 52 | (mant & 0x000FFFFFFFFFFFFFull);
+  if (neg)
+    bits |= 0x8000000000000000ull;
+  memcpy (x, &bits, sizeof (double));
+  return 1;
+}
+
+/* strtod() on a copy of the field at s */
+static const char *
+slow_double (const char *s, int comma, double *x)
+{
+  char buf[MAXFIELD];
+  char *end;
+  int n;
+
+  for (n = 0; n < MAXFIELD - 1 && s[n] != 0 && s[n] != ' '
+       && s[n] != '\t' && s[n] != '\n'; n++)
+    buf[n] = (comma && s[n] == ',') ? '.' : s[n];
+  buf[n] = 0;
+  *x = strtod (buf, &end);
+  if (end == buf)
+    return NULL;
+  return s + (end - buf);
+}
+
+/*
+	parses the number at the beginning of s into *x, like strtod()
+	returns the address of the first character after the number,
+	NULL if there is no number
+*/
+const char *
+scan_double (const char *s, int comma, double *x)
+{
+  const char *p = s;
+  uint64_t w = 0;
+  int neg = 0, nd = 0, any = 0, q = 0, e = 0, eneg;
+
+  if (*p == '+' || *p == '-')
+    neg = (*p++ == '-');
+  for (; *p == '0'; p++)
+    any = 1;
+  if (*p == 'x' || *p == 'X')
+    return slow_double (s, comma, x);
+  for (; *p >= '0' && *p <= '9'; p++, nd++, any = 1)
+    {
+      if (nd == 19)
+	return slow_double (s, comma, x);
+      w = 10 * w + (uint64_t) (*p - '0');
+    }
+  if (*p == '.' || (comma && *p == ','))
+    {
+      p++;
+      if (nd == 0)
+	for (; *p == '0'; p++, q--)
+	  any = 1;
+      for (; *p >= '0' && *p <= '9'; p++, nd++, q--, any = 1)
+	{
+	  if (nd == 19)
+	    return slow_double (s, comma, x);
+	  w = 10 * w + (uint64_t) (*p - '0');
+	}
+    }
+  if (!any)
+    return slow_double (s, comma, x);
+  if (*p == 'e' || *p == 'E')
+    {
+      const char *pe = p + 1;
+
+      eneg = 0;
+      if (*pe == '+' || *pe == '-')
+	eneg = (*pe++ == '-');
+      if (*pe >= '0' && *pe <= '9')
+	{
+	  for (; *pe >= '0' && *pe <= '9'; pe++)
+	    if (e < 100000)
+	      e = 10 * e + (*pe - '0');
+	  q += eneg ? -e : e;
+	  p = pe;
+	}
+    }
+
+  if (w == 0)
+    {
+      *x = neg ? -0.0 : 0.0;
+      return p;
+    }
+#if FLT_EVAL_METHOD == 0
+  if (w < ((uint64_t) 1 << 53) && q >= -22 && q <= 22)
+    {
+      *x = (q < 0) ? (double) w / exact10[-q] : (double) w * exact10[q];
+      if (neg)
+	*x = -*x;
+      return p;
+    }
+#endif
+  pthread_once (&table_once, make_table);
+  if (eisel_lemire (w, q, neg, x))
+    return p;
+  return slow_double (s, comma, x);
+}
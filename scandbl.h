@@ -0,0 +1,6 @@
+#ifndef __scandbl_h
+#define __scandbl_h
+
+const char *scan_double (const char *s, int comma, double *x);
+
+#endif
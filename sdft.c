@@ -0,0 +1,175 @@
+/********************************************************************************
+    sdft.c
+
+    sliding DFT of all segments of one frequency bin for cosine-sum windows
+
+    A cosine-sum window win[j] = sum_k c[k]*cos(2*pi*k*j/nfft) turns the
+    windowed DFT at bin m into a combination of rectangular DFTs:
+
+	X(m) = c[0]*R(m) + sum_{k>0} c[k]/2 * (R(m-k) + R(m+k))
+
+    The rectangular DFT of the segment starting at s is
+	R_s(b) = exp(i*2*pi*b*s/nfft) * (P_b(s+nfft) - P_b(s)),
+    where P_b(t) = sum_{n<t} x[n]*exp(-i*2*pi*b*n/nfft) is a prefix sum over
+    the whole time series. sdft_segments() runs once through the data for
+    each of the 2*ncos-1 frequencies m-k..m+k and records P_b at every
+    segment start and end, so the cost is about (2*ncos-1)*nread instead of
+    nfft*nseg for the direct DFT, independent of the overlap.
+
+    Between two segment boundaries the data are summed with the vectorized
+    dot product of dftkern.c; these partial sums are added to the prefix
+    sums in double-double arithmetic, so that the difference of two prefix
+    sums is as accurate as a direct sum over the segment.
+ ********************************************************************************/
+#include <stdlib.h>
+#include <limits.h>
+#include "misc.h"
+#include "phasor.h"
+#include "dftkern.h"
+#include "detrend.h"
+#include "sdft.h"
+
+#define SDBLOCK 4096		/* samples per block of phasors */
+
+typedef struct
+{
+  tDD re, im;
+} tCDD;				/* complex double-double */
+
+typedef struct
+{
+  long long pos;		/* sample index of the boundary */
+  long long start;		/* segment starting here, or -1 */
+  long long end;		/* segment ending here, or -1 */
+} tCUT;
+
+/* adds coef * exp(i*phi) * (Pe - Ps) to re + i*im, z = exp(i*phi) */
+static void
+add_segment (tCDD Pe, tCDD Ps, const double *z, double coef, double *re,
+	     double *im)
+{
+  double rr = dd_diff (Pe.re, Ps.re);
+  double ri = dd_diff (Pe.im, Ps.im);
+
+  *re += coef * (rr * z[0] - ri * z[1]);
+  *im += coef * (rr * z[1] + ri * z[0]);
+}
+
+/*
+	computes the DFTs at bin of the nseg segments x[q*segoff..q*segoff+nfft-1]
+	of the series of dt for the cosine-sum window with coefficients
+	cw[0..ncos-1]
+
+	At most nopen segments overlap any sample, so the prefix sums and
+	phasors at the segment starts are kept in rings of nopen entries.
+
+	output
+		seg_re, seg_im	windowed DFT of every segment, not detrended,
+				in raw units of a compact series
+*/
+void
+sdft_segments (const tDTIDX * dt, long long nfft, double bin, long long segoff,
+	       long long nseg, const double *cw, int ncos, double *seg_re,
+	       double *seg_im)
+{
+  int nf = 2 * ncos - 1;	/* frequencies bin-ncos+1..bin+ncos-1 */
+  long long nopen;		/* max. number of overlapping segments */
+  tCDD *P;			/* running prefix sums, one per frequency */
+  tCDD *Ps;			/* prefix sums at open segment starts */
+  double *Zs;			/* exp(i*2*pi*b*start/nfft) of open segments */
+  double *coef;			/* window coefficient of every frequency */
+  tCUT *cut;			/* segment boundaries in increasing order */
+  long long ncut;
+  double *pc, *ps;		/* cos, sin of one block */
+  double b, re, im;
+  long long i, j, c, cf, nb, end, ts, te, o;
+  int f, len, stop, has;
+
+  /* merge segment starts q*segoff and ends q*segoff+nfft */
+  cut = (tCUT *) xmalloc (2 * nseg * sizeof (tCUT));
+  ncut = 0;
+  for (i = 0, j = 0; i < nseg || j < nseg;)
+    {
+      ts = (i < nseg) ? i * segoff : LLONG_MAX;
+      te = (j < nseg) ? j * segoff + nfft : LLONG_MAX;
+      cut[ncut].pos = (ts < te) ? ts : te;
+      cut[ncut].start = (ts == cut[ncut].pos) ? i++ : -1;
+      cut[ncut].end = (te == cut[ncut].pos) ? j++ : -1;
+      ncut++;
+    }
+  end = (nseg - 1) * segoff + nfft;
+  nopen = (nfft + segoff - 1) / segoff + 1;
+
+  P = (tCDD *) xmalloc (nf * sizeof (tCDD));
+  Ps = (tCDD *) xmalloc (nf * nopen * sizeof (tCDD));
+  Zs = (double *) xmalloc (2 * nf * nopen * sizeof (double));
+  coef = (double *) xmalloc (nf * sizeof (double));
+  pc = (double *) xmalloc_align (DFT_ALIGN, SDBLOCK * sizeof (double));
+  ps = (double *) xmalloc_align (DFT_ALIGN, SDBLOCK * sizeof (double));
+  for (f = 0; f < nf; f++)
+    {
+      P[f].re.hi = P[f].re.lo = P[f].im.hi = P[f].im.lo = 0;
+      coef[f] = (f == ncos - 1) ? cw[0] : 0.5 * cw[abs (f - (ncos - 1))];
+    }
+  for (i = 0; i < nseg; i++)
+    seg_re[i] = seg_im[i] = 0;
+
+  /*
+     every block is summed for one frequency after the other; a boundary
+     at sample nb+stop, stop < len, is handled when the block has been
+     summed up to it, where the phasor of the start is pc[stop], ps[stop]
+   */
+  for (c = 0, nb = 0; nb < end; nb += SDBLOCK, c = cf)
+    {
+      len = (end - nb < SDBLOCK) ? end - nb : SDBLOCK;
+      for (cf = c, f = 0; f < nf; f++)
+	{
+	  b = bin + f - (ncos - 1);
+	  phasor_fill (b, nfft, nb, len, pc, ps);
+	  for (cf = c, j = 0;; j = stop)
+	    {
+	      has = (cf < ncut && cut[cf].pos - nb < len);
+	      stop = has ? cut[cf].pos - nb : len;
+	      if (stop > j)
+		{
+		  dft_dot_smp (dt, nb + j, pc + j, ps + j, stop - j, &re, &im);
+		  dd_add_d (&P[f].re, re);
+		  dd_add_d (&P[f].im, -im);
+		}
+	      if (!has)
+		break;
+	      if (cut[cf].end >= 0)
+		{
+		  o = f * nopen + cut[cf].end % nopen;
+		  add_segment (P[f], Ps[o], &Zs[2 * o], coef[f],
+			       &seg_re[cut[cf].end], &seg_im[cut[cf].end]);
+		}
+	      if (cut[cf].start >= 0)
+		{
+		  o = f * nopen + cut[cf].start % nopen;
+		  Ps[o] = P[f];
+		  Zs[2 * o] = pc[stop];
+		  Zs[2 * o + 1] = ps[stop];
+		}
+	      cf++;
+	    }
+	}
+    }
+
+  /* the segments ending at the last sample */
+  for (; c < ncut; c++)
+    for (f = 0; f < nf; f++)
+      {
+	o = f * nopen + cut[c].end % nopen;
+	add_segment (P[f], Ps[o], &Zs[2 * o], coef[f], &seg_re[cut[c].end],
+		     &seg_im[cut[c].end]);
+      }
+
+  xfree (ps);
+  xfree (pc);
+  xfree (coef);
+  xfree (Zs);
+  xfree (Ps);
+  xfree (P);
+  xfree (cut);
+}
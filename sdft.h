@@ -0,0 +1,10 @@
+#ifndef __sdft_h
+#define __sdft_h
+
+#include "detrend.h"
+
+void sdft_segments (const tDTIDX * dt, long long nfft, double bin,
+		    long long segoff, long long nseg, const double *cw, int ncos,
+		    double *seg_re, double *seg_im);
+
+#endif
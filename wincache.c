@@ -0,0 +1,182 @@
+/********************************************************************************
+    wincache.c
+
+    cache of window tables shared by all frequency bins of lpsd
+
+    Many consecutive frequency bins use the same nfft, and the window
+    values depend on nfft only (for a given window type and, for Kaiser
+    windows, alpha). The cache keeps the real window values together with
+    winsum, winsum2 and nenbw, so that makewin() is called once per nfft
+    instead of once per bin; the per-bin work reduces to modwinsincos().
+
+    The total size of all tables is limited by a memory budget. Tables that
+    are not in use are evicted in least recently used order as soon as the
+    budget is exceeded. Tables in use are never evicted, so the budget may
+    be exceeded temporarily by the tables of the running bins.
+
+    The cache is thread-safe: a table is computed by the first thread that
+    asks for it, other threads asking for the same table wait until it is
+    ready.
+ ********************************************************************************/
+#include <stdlib.h>
+#include <pthread.h>
+#include "misc.h"
+#include "genwin.h"
+#include "wincache.h"
+
+static tWINTAB *head = NULL;	/* most recently used table */
+static tWINTAB *tail = NULL;	/* least recently used table */
+static double budget = 0;	/* memory budget in bytes */
+static double used = 0;		/* memory used by all tables in bytes */
+static long hits = 0, misses = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ready = PTHREAD_COND_INITIALIZER;
+
+static void
+unlink_table (tWINTAB * w)
+{
+  if (w->prev)
+    w->prev->next = w->next;
+  else
+    head = w->next;
+  if (w->next)
+    w->next->prev = w->prev;
+  else
+    tail = w->prev;
+  w->prev = w->next = NULL;
+}
+
+static void
+push_front (tWINTAB * w)
+{
+  w->prev = NULL;
+  w->next = head;
+  if (head)
+    head->prev = w;
+  head = w;
+  if (!tail)
+    tail = w;
+}
+
+/* removes unused tables, least recently used first, until budget is met */
+static void
+evict (void)
+{
+  tWINTAB *w, *prev;
+
+  for (w = tail; w && used > budget; w = prev)
+    {
+      prev = w->prev;
+      if (w->refs > 0)
+	continue;
+      unlink_table (w);
+      used -= w->nfft * sizeof (double);
+      xfree (w->win);
+      xfree (w);
+    }
+}
+
+/*
+	sets the memory budget of the cache in bytes
+	must be called before the first call of wincache_get
+*/
+void
+wincache_init (double bytes)
+{
+  pthread_mutex_lock (&lock);
+  budget = bytes;
+  hits = misses = 0;
+  evict ();
+  pthread_mutex_unlock (&lock);
+}
+
+/*
+	returns the window table of length nfft for the window set by
+	set_window; the table must be given back by wincache_release
+*/
+const tWINTAB *
+wincache_get (long long nfft)
+{
+  tWINTAB *w;
+  int no;
+  double alpha;
+
+  window_id (&no, &alpha);
+  pthread_mutex_lock (&lock);
+  for (w = head; w; w = w->next)
+    if (w->nfft == nfft && w->wtype == no && w->walpha == alpha)
+      break;
+  if (w)
+    {
+      hits++;
+      w->refs++;
+      unlink_table (w);
+      push_front (w);
+      while (!w->ready)
+	pthread_cond_wait (&ready, &lock);
+      pthread_mutex_unlock (&lock);
+      return w;
+    }
+
+  /* not found: insert an empty table, compute it without holding the lock */
+  misses++;
+  w = (tWINTAB *) xmalloc (sizeof (tWINTAB));
+  w->nfft = nfft;
+  w->wtype = no;
+  w->walpha = alpha;
+  w->refs = 1;
+  w->ready = 0;
+  w->win = NULL;
+  push_front (w);
+  used += nfft * sizeof (double);
+  evict ();
+  pthread_mutex_unlock (&lock);
+
+  w->win = (double *) xmalloc (nfft * sizeof (double));
+  makewin (nfft, 0, w->win, &w->winsum, &w->winsum2, &w->nenbw);
+
+  pthread_mutex_lock (&lock);
+  w->ready = 1;
+  pthread_cond_broadcast (&ready);
+  pthread_mutex_unlock (&lock);
+  return w;
+}
+
+/* gives back a table obtained by wincache_get */
+void
+wincache_release (const tWINTAB * cw)
+{
+  tWINTAB *w = (tWINTAB *) cw;
+
+  pthread_mutex_lock (&lock);
+  w->refs--;
+  evict ();
+  pthread_mutex_unlock (&lock);
+}
+
+/* returns the number of cache hits and misses since wincache_init */
+void
+wincache_stats (long *nhits, long *nmisses)
+{
+  pthread_mutex_lock (&lock);
+  *nhits = hits;
+  *nmisses = misses;
+  pthread_mutex_unlock (&lock);
+}
+
+/* frees all tables, no table may be in use */
+void
+wincache_free (void)
+{
+  tWINTAB *w;
+
+  pthread_mutex_lock (&lock);
+  while ((w = head) != NULL)
+    {
+      unlink_table (w);
+      xfree (w->win);
+      xfree (w);
+    }
+  used = 0;
+  pthread_mutex_unlock (&lock);
+}
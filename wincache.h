@@ -0,0 +1,23 @@
+#ifndef __wincache_h
+#define __wincache_h
+
+typedef struct tWINTAB
+{
+  long long nfft;		/* length of window */
+  double *win;			/* window values win[0..nfft-1] */
+  double winsum, winsum2;	/* sum of window values, of squared window values */
+  double nenbw;			/* normalized equivalent noise bandwidth */
+  int wtype;			/* window number, -1 Kaiser (see window_id) */
+  double walpha;		/* Kaiser parameter alpha */
+  int refs;			/* number of users of this table */
+  int ready;			/* 0 while the table is being computed */
+  struct tWINTAB *prev, *next;	/* LRU list, most recently used first */
+} tWINTAB;
+
+void wincache_init (double bytes);
+const tWINTAB *wincache_get (long long nfft);
+void wincache_release (const tWINTAB * w);
+void wincache_stats (long *nhits, long *nmisses);
+void wincache_free (void);
+
+#endif
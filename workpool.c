@@ -0,0 +1,278 @@
+/********************************************************************************
+    workpool.c
+
+    cost-aware thread pool with work stealing for the frequency loop of lpsd
+
+    Every task (usually one frequency bin) comes with an estimate of its cost.
+    Tasks are sorted by decreasing cost and dealt to the workers so that each
+    worker receives about the same total cost (longest processing time first).
+    A worker always takes the most expensive task left in its own queue; once
+    its queue is empty, it steals the most expensive pending task from the
+    worker that has the largest amount of work left. The calling thread does
+    not work itself, it only reports progress.
+ ********************************************************************************/
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+#include "config.h"
+#include "misc.h"
+#include "errors.h"
+#include "workpool.h"
+
+typedef struct
+{
+  int *task;			/* task numbers, ordered by decreasing cost */
+  int ntask;			/* number of tasks in queue */
+  int head;			/* next task to be taken */
+  double pending;		/* sum of costs of tasks not yet taken */
+  pthread_mutex_t lock;
+} tQUEUE;
+
+typedef struct
+{
+  tQUEUE *queue;		/* one queue per worker */
+  int nthreads;
+  const double *cost;
+  void (*work) (int task, void *arg);
+  void *arg;
+  double done;			/* sum of costs of finished tasks */
+  int running;			/* number of workers still running */
+  pthread_mutex_t lock;		/* protects done and running */
+  pthread_cond_t finished;
+} tPOOL;
+
+typedef struct
+{
+  tPOOL *pool;
+  int id;
+} tWORKER;
+
+typedef struct
+{
+  double cost;
+  int task;
+} tCOSTIDX;
+
+/*
+	returns the number of worker threads to be used
+	req > 0 is taken as it is, otherwise one thread per online processor
+*/
+int
+get_nthreads (int req)
+{
+  long n;
+
+  if (req > 0)
+    return req;
+  n = sysconf (_SC_NPROCESSORS_ONLN);
+  return (n > 0) ? (int) n : 1;
+}
+
+static int
+cmp_cost (const void *a, const void *b)
+{
+  double ca = ((const tCOSTIDX *) a)->cost;
+  double cb = ((const tCOSTIDX *) b)->cost;
+
+  if (ca > cb)
+    return -1;
+  if (ca < cb)
+    return 1;
+  return ((const tCOSTIDX *) a)->task - ((const tCOSTIDX *) b)->task;
+}
+
+/* takes the most expensive pending task from queue q, returns -1 if empty */
+static int
+take_task (tPOOL * pool, tQUEUE * q)
+{
+  int t = -1;
+
+  pthread_mutex_lock (&q->lock);
+  if (q->head < q->ntask)
+    {
+      t = q->task[q->head++];
+      q->pending -= pool->cost[t];
+    }
+  pthread_mutex_unlock (&q->lock);
+  return t;
+}
+
+/* steals a task from the worker with the largest amount of pending work */
+static int
+steal_task (tPOOL * pool, int self)
+{
+  int i, victim, t;
+  double most;
+
+  do
+    {
+      victim = -1;
+      most = 0;
+      for (i = 0; i < pool->nthreads; i++)
+	{
+	  if (i == self)
+	    continue;
+	  pthread_mutex_lock (&pool->queue[i].lock);
+	  if ((pool->queue[i].head < pool->queue[i].ntask)
+	      && (victim < 0 || pool->queue[i].pending > most))
+	    {
+	      victim = i;
+	      most = pool->queue[i].pending;
+	    }
+	  pthread_mutex_unlock (&pool->queue[i].lock);
+	}
+      if (victim < 0)
+	return -1;
+      t = take_task (pool, &pool->queue[victim]);
+    }
+  while (t < 0);		/* victim was emptied in the meantime */
+  return t;
+}
+
+static void *
+worker (void *p)
+{
+  tWORKER *w = (tWORKER *) p;
+  tPOOL *pool = w->pool;
+  int t;
+
+  for (;;)
+    {
+      t = take_task (pool, &pool->queue[w->id]);
+      if (t < 0)
+	t = steal_task (pool, w->id);
+      if (t < 0)
+	break;
+      pool->work (t, pool->arg);
+      pthread_mutex_lock (&pool->lock);
+      pool->done += pool->cost[t];
+      pthread_mutex_unlock (&pool->lock);
+    }
+
+  pthread_mutex_lock (&pool->lock);
+  pool->running--;
+  pthread_cond_signal (&pool->finished);
+  pthread_mutex_unlock (&pool->lock);
+  return NULL;
+}
+
+/*
+	runs work(task, arg) for task = 0..ntask-1 on nthreads worker threads
+
+	input
+		cost		estimated cost of every task, used for scheduling
+		progress	if not NULL, called every PSTEP seconds with the
+				fraction of the total cost done so far
+*/
+void
+run_tasks (int ntask, const double *cost, int nthreads,
+	   void (*work) (int task, void *arg), void *arg,
+	   void (*progress) (double done))
+{
+  tPOOL pool;
+  tWORKER *w;
+  tCOSTIDX *order;
+  pthread_t *tid;
+  double *load, total;
+  int i, j, least;
+  struct timeval tv;
+  struct timespec until;
+
+  if (ntask <= 0)
+    return;
+  if (nthreads < 1)
+    nthreads = 1;
+  if (nthreads > ntask)
+    nthreads = ntask;
+
+  pool.nthreads = nthreads;
+  pool.cost = cost;
+  pool.work = work;
+  pool.arg = arg;
+  pool.done = 0;
+  pool.running = nthreads;
+  pthread_mutex_init (&pool.lock, NULL);
+  pthread_cond_init (&pool.finished, NULL);
+
+  pool.queue = (tQUEUE *) xmalloc (nthreads * sizeof (tQUEUE));
+  load = (double *) xmalloc (nthreads * sizeof (double));
+  for (i = 0; i < nthreads; i++)
+    {
+      pool.queue[i].task = (int *) xmalloc (ntask * sizeof (int));
+      pool.queue[i].ntask = 0;
+      pool.queue[i].head = 0;
+      pool.queue[i].pending = 0;
+      pthread_mutex_init (&pool.queue[i].lock, NULL);
+      load[i] = 0;
+    }
+
+  /* deal tasks, most expensive first, to the least loaded worker */
+  order = (tCOSTIDX *) xmalloc (ntask * sizeof (tCOSTIDX));
+  for (i = 0; i < ntask; i++)
+    {
+      order[i].cost = cost[i];
+      order[i].task = i;
+    }
+  qsort (order, ntask, sizeof (tCOSTIDX), cmp_cost);
+  total = 0;
+  for (i = 0; i < ntask; i++)
+    {
+      least = 0;
+      for (j = 1; j < nthreads; j++)
+	if (load[j] < load[least])
+	  least = j;
+      pool.queue[least].task[pool.queue[least].ntask++] = order[i].task;
+      pool.queue[least].pending += order[i].cost;
+      load[least] += order[i].cost;
+      total += order[i].cost;
+    }
+  xfree (order);
+
+  w = (tWORKER *) xmalloc (nthreads * sizeof (tWORKER));
+  tid = (pthread_t *) xmalloc (nthreads * sizeof (pthread_t));
+  for (i = 0; i < nthreads; i++)
+    {
+      w[i].pool = &pool;
+      w[i].id = i;
+      if (pthread_create (&tid[i], NULL, worker, &w[i]) != 0)
+	gerror ("Cannot create worker thread");
+    }
+
+  /* report progress until all workers have finished */
+  pthread_mutex_lock (&pool.lock);
+  while (pool.running > 0)
+    {
+      gettimeofday (&tv, NULL);
+      until.tv_sec = tv.tv_sec + (time_t) PSTEP;
+      until.tv_nsec = tv.tv_usec * 1000L
+	+ (long) ((PSTEP - (time_t) PSTEP) * 1e9);
+      if (until.tv_nsec >= 1000000000L)
+	{
+	  until.tv_sec++;
+	  until.tv_nsec -= 1000000000L;
+	}
+      pthread_cond_timedwait (&pool.finished, &pool.lock, &until);
+      if (progress && pool.running > 0 && total > 0)
+	progress (pool.done / total);
+    }
+  pthread_mutex_unlock (&pool.lock);
+
+  for (i = 0; i < nthreads; i++)
+    pthread_join (tid[i], NULL);
+
+  /* clean up */
+  for (i = 0; i < nthreads; i++)
+    {
+      pthread_mutex_destroy (&pool.queue[i].lock);
+      xfree (pool.queue[i].task);
+    }
+  pthread_mutex_destroy (&pool.lock);
+  pthread_cond_destroy (&pool.finished);
+  xfree (pool.queue);
+  xfree (load);
+  xfree (w);
+  xfree (tid);
+}
@@ -0,0 +1,9 @@
+#ifndef __workpool_h
+#define __workpool_h
+
+int get_nthreads (int req);
+void run_tasks (int ntask, const double *cost, int nthreads,
+		void (*work) (int task, void *arg), void *arg,
+		void (*progress) (double done));
+
+#endif